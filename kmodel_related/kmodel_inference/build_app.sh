@@ -31,11 +31,22 @@ if [ "$1" == "debug" ]; then
     cp -a shell/face_detect_main_nncase_with_aibase.sh ${k230_bin}/debug
     cp -a shell/face_detect_main_nncase.sh ${k230_bin}/debug
     cp -a shell/face_recognize_main_nncase.sh ${k230_bin}/debug
+    cp -a shell/face_detect_main_nncase_benchmark.sh ${k230_bin}/debug
+    cp -a shell/face_recognize_main_nncase_benchmark.sh ${k230_bin}/debug
+    cp -a shell/face_detect_regression.sh ${k230_bin}/debug
 
     if [ -f out/bin/main_nncase.elf ]; then
       cp out/bin/main_nncase.elf ${k230_bin}/debug
     fi
 
+    if [ -f out/bin/regression.elf ]; then
+      cp out/bin/regression.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/pipeline_replay.elf ]; then
+      cp out/bin/pipeline_replay.elf ${k230_bin}/debug
+    fi
+
     if [ -f out/bin/test_scoped_timing.elf ]; then
       cp out/bin/test_scoped_timing.elf ${k230_bin}/debug
     fi
@@ -51,6 +62,82 @@ if [ "$1" == "debug" ]; then
     if [ -f out/bin/test_aibase.elf ]; then
       cp out/bin/test_aibase.elf ${k230_bin}/debug
     fi
+
+    if [ -f out/bin/test_preprocess.elf ]; then
+      cp out/bin/test_preprocess.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_binary_io.elf ]; then
+      cp out/bin/test_binary_io.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_osd.elf ]; then
+      cp out/bin/test_osd.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_text.elf ]; then
+      cp out/bin/test_text.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_mailbox.elf ]; then
+      cp out/bin/test_mailbox.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_profiler.elf ]; then
+      cp out/bin/test_profiler.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_trace.elf ]; then
+      cp out/bin/test_trace.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_metrics.elf ]; then
+      cp out/bin/test_metrics.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_mem_accounting.elf ]; then
+      cp out/bin/test_mem_accounting.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_output_compare.elf ]; then
+      cp out/bin/test_output_compare.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_tracker.elf ]; then
+      cp out/bin/test_tracker.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_motion_gate.elf ]; then
+      cp out/bin/test_motion_gate.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_face_quality.elf ]; then
+      cp out/bin/test_face_quality.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_embedding.elf ]; then
+      cp out/bin/test_embedding.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_streams.elf ]; then
+      cp out/bin/test_streams.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_latency_policy.elf ]; then
+      cp out/bin/test_latency_policy.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_frame_source.elf ]; then
+      cp out/bin/test_frame_source.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_display_sink.elf ]; then
+      cp out/bin/test_display_sink.elf ${k230_bin}/debug
+    fi
+
+    if [ -f out/bin/test_postprocess.elf ]; then
+      cp out/bin/test_postprocess.elf ${k230_bin}/debug
+    fi
 else
     echo "Release mode"
 fi
@@ -73,4 +160,12 @@ if [ -f out/bin/face_recognition.elf ]; then
       cp out/bin/face_recognition.elf ${k230_bin}/face_recognize
 fi
 
+if [ -f out/bin/multi_camera.elf ]; then
+      mkdir -p ${k230_bin}/multi_camera
+      cp -a shell/multi_camera_isp.sh ${k230_bin}/multi_camera
+      cp -a ${k230_kmodel}/face_detect_640.kmodel ${k230_bin}/multi_camera
+      cp -a ${k230_kmodel}/face_recognize.kmodel ${k230_bin}/multi_camera
+      cp out/bin/multi_camera.elf ${k230_bin}/multi_camera
+fi
+
 rm -rf out
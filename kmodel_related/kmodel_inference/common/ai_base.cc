@@ -37,14 +37,19 @@ using std::endl;
 using namespace nncase;
 using namespace nncase::runtime::detail;
 
-AIBase::AIBase(const char *kmodel_file,const string model_name, const int debug_mode) : debug_mode_(debug_mode),model_name_(model_name)
+AIBase::AIBase(const char *kmodel_file,const string model_name, const int debug_mode) : model_name_(model_name), debug_mode_(debug_mode),
+    mem_tracker_(model_name, debug_mode > 1 || MemTracker::env_enabled()),
+    run_label_(model_name + " run"), get_output_label_(model_name + " get_output")
 {
     if (debug_mode > 1)
         cout << "kmodel_file:" << kmodel_file << endl;
     std::ifstream ifs(kmodel_file, std::ios::binary);
     kmodel_interp_.load_model(ifs).expect("Invalid kmodel");
+    mem_tracker_.mark("load_model");
     set_input_init();
+    mem_tracker_.mark("input tensors");
     set_output_init();
+    mem_tracker_.mark("output tensors");
 }
 
 AIBase::~AIBase()
@@ -162,15 +167,20 @@ void AIBase::set_output_init()
     }
 }
 
+void AIBase::memory_report()
+{
+    mem_tracker_.report();
+}
+
 void AIBase::run()
 {
-    ScopedTiming st(model_name_ + " run", debug_mode_);
+    ScopedTiming st(run_label_, debug_mode_);
     kmodel_interp_.run().expect("error occurred in running model");
 }
 
 void AIBase::get_output()
 {
-    ScopedTiming st(model_name_ + " get_output", debug_mode_);
+    ScopedTiming st(get_output_label_, debug_mode_);
     p_outputs_.clear();
     for (int i = 0; i < kmodel_interp_.outputs_size(); i++)
     {
@@ -32,6 +32,7 @@
 
 #include <nncase/runtime/interpreter.h>
 #include "scoped_timing.hpp"
+#include "mem_accounting.h"
 
 using std::string;
 using std::vector;
@@ -77,6 +78,13 @@ public:
      */
     void get_output();
 
+    /**
+     * @brief 打印该实例各构建阶段（load_model、输入输出tensor、ai2d等）的mmz/堆内存变化及峰值、稳定值
+     * debug_mode>1或环境变量K230_MEM_ACCOUNTING=1时记录，否则不输出
+     * @return None
+     */
+    void memory_report();
+
 protected:
     string model_name_;                    // 模型名字
     int debug_mode_;                       // 调试模型，0（不打印），1（打印时间），2（打印所有）
@@ -85,6 +93,7 @@ protected:
     vector<vector<int>> output_shapes_;    //{{N,C,H,W},{N,C,H,W}...}} 或 {{N,C},{N,C}...}}等
     vector<int> each_input_size_by_byte_;  //{0,layer1_length,layer1_length+layer2_length,...}
     vector<int> each_output_size_by_byte_; //{0,layer1_length,layer1_length+layer2_length,...}
+    MemTracker mem_tracker_;               // 按构建阶段记录内存变化，子类在创建ai2d等资源后调用mark
 private:
     /**
      * @brief 首次初始化kmodel输入，并获取输入shape
@@ -98,6 +107,9 @@ private:
      */
     void set_output_init();
 
+    TimingLabel run_label_;            // run计时名称，构造时拼接一次
+    TimingLabel get_output_label_;     // get_output计时名称
+
     interpreter kmodel_interp_;        // kmodel解释器，从kmodel文件构建，负责模型的加载、输入输出设置和推理
     vector<unsigned char> kmodel_vec_; // 通过读取kmodel文件得到整个kmodel数据，用于传给kmodel解释器加载kmodel
 };
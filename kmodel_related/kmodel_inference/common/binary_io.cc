@@ -0,0 +1,249 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "binary_io.h"
+
+// O_DIRECT要求的地址、偏移、长度对齐
+#define DIRECT_IO_ALIGN (4096)
+
+MappedFile::MappedFile() : fd_(-1), data_(nullptr), size_(0)
+{
+}
+
+MappedFile::MappedFile(const char *file_name, ReadHint hint) : fd_(-1), data_(nullptr), size_(0)
+{
+    open(file_name, hint);
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile &&other) : fd_(other.fd_), data_(other.data_), size_(other.size_)
+{
+    other.fd_ = -1;
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other)
+{
+    if (this != &other)
+    {
+        close();
+        fd_ = other.fd_;
+        data_ = other.data_;
+        size_ = other.size_;
+        other.fd_ = -1;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+bool MappedFile::open(const char *file_name, ReadHint hint)
+{
+    close();
+    int fd = ::open(file_name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        std::cerr << "MappedFile: cannot open " << file_name << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        std::cerr << "MappedFile: cannot stat " << file_name << ": " << strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = st.st_size;
+    if (size > 0)
+    {
+        void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED)
+        {
+            std::cerr << "MappedFile: cannot mmap " << file_name << ": " << strerror(errno) << std::endl;
+            ::close(fd);
+            return false;
+        }
+        if (hint != READ_DEFAULT)
+            madvise(addr, size, MADV_SEQUENTIAL | MADV_WILLNEED);
+        data_ = reinterpret_cast<const uint8_t *>(addr);
+    }
+    fd_ = fd;
+    size_ = size;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data_ != nullptr)
+        munmap(const_cast<uint8_t *>(data_), size_);
+    if (fd_ >= 0)
+        ::close(fd_);
+    fd_ = -1;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+void BinaryIO::report(const char *file_name, const char *what)
+{
+    std::cerr << "BinaryIO: " << file_name << ": " << what << std::endl;
+}
+
+bool BinaryIO::file_size(const char *file_name, size_t &size)
+{
+    struct stat st;
+    if (stat(file_name, &st) != 0)
+    {
+        report(file_name, strerror(errno));
+        return false;
+    }
+    size = st.st_size;
+    return true;
+}
+
+// 循环读满len字节，处理EINTR和短读
+static bool read_full(int fd, uint8_t *dst, size_t len, size_t &done)
+{
+    done = 0;
+    while (done < len)
+    {
+        ssize_t n = read(fd, dst + done, len - done);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (n == 0)
+            break;
+        done += n;
+    }
+    return true;
+}
+
+bool BinaryIO::read_into(const char *file_name, void *dst, size_t capacity, size_t &read_size, ReadHint hint)
+{
+    read_size = 0;
+    uint8_t *out = reinterpret_cast<uint8_t *>(dst);
+
+    // O_DIRECT只用于对齐的部分：目标地址对齐，且至少有一个完整的对齐块
+    int flags = O_RDONLY | O_CLOEXEC;
+    bool direct = false;
+    if (hint == READ_DIRECT && reinterpret_cast<uintptr_t>(dst) % DIRECT_IO_ALIGN == 0 && capacity >= DIRECT_IO_ALIGN)
+    {
+        flags |= O_DIRECT;
+        direct = true;
+    }
+
+    int fd = open(file_name, flags);
+    if (fd < 0 && direct)
+    {
+        // 部分文件系统（如tmpfs）不支持O_DIRECT
+        flags &= ~O_DIRECT;
+        direct = false;
+        fd = open(file_name, flags);
+    }
+    if (fd < 0)
+    {
+        report(file_name, strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        report(file_name, strerror(errno));
+        close(fd);
+        return false;
+    }
+    size_t len = st.st_size;
+    if (len > capacity)
+    {
+        std::cerr << "BinaryIO: " << file_name << ": file size " << len << " exceeds buffer size " << capacity << std::endl;
+        close(fd);
+        return false;
+    }
+
+    if (hint == READ_SEQUENTIAL)
+        posix_fadvise(fd, 0, len, POSIX_FADV_SEQUENTIAL);
+
+    size_t done = 0;
+    bool ok = true;
+    if (direct)
+    {
+        size_t aligned_len = len / DIRECT_IO_ALIGN * DIRECT_IO_ALIGN;
+        ok = read_full(fd, out, aligned_len, done);
+        if (!ok && errno == EINVAL)
+        {
+            // 对齐要求不满足（块大小大于DIRECT_IO_ALIGN等），从头按普通方式读
+            lseek(fd, 0, SEEK_SET);
+            done = 0;
+            ok = true;
+        }
+        // 剩余不足一个对齐块的部分关掉O_DIRECT再读
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT);
+    }
+    if (ok)
+    {
+        size_t tail = 0;
+        ok = read_full(fd, out + done, len - done, tail);
+        done += tail;
+    }
+    if (!ok)
+        report(file_name, strerror(errno));
+    else if (done != len)
+    {
+        report(file_name, "file shrank while reading");
+        ok = false;
+    }
+    close(fd);
+    read_size = done;
+    return ok;
+}
+
+bool BinaryIO::read_exact(const char *file_name, void *dst, size_t capacity, ReadHint hint)
+{
+    size_t read_size;
+    if (!read_into(file_name, dst, capacity, read_size, hint))
+        return false;
+    if (read_size != capacity)
+    {
+        std::cerr << "BinaryIO: " << file_name << ": file size " << read_size << " does not match buffer size " << capacity << std::endl;
+        return false;
+    }
+    return true;
+}
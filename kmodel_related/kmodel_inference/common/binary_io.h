@@ -0,0 +1,162 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _BINARY_IO_H
+#define _BINARY_IO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 文件读取提示
+ * READ_DEFAULT：不做任何提示；READ_SEQUENTIAL：顺序读，开启内核预读（posix_fadvise/madvise）；
+ * READ_DIRECT：使用O_DIRECT绕过page cache，目标地址或文件系统不满足对齐要求时自动退回普通读
+ */
+enum ReadHint
+{
+    READ_DEFAULT = 0,
+    READ_SEQUENTIAL = 1,
+    READ_DIRECT = 2,
+};
+
+/**
+ * @brief 只读mmap文件视图
+ * 直接访问文件内容，不经过中间vector拷贝；对象销毁时自动munmap
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+
+    /**
+     * @brief 打开并映射文件，失败时is_open()为false
+     * @param file_name 文件路径
+     * @param hint      读取提示（READ_DIRECT对mmap无意义，按READ_SEQUENTIAL处理）
+     * @return None
+     */
+    explicit MappedFile(const char *file_name, ReadHint hint = READ_SEQUENTIAL);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other);
+    MappedFile &operator=(MappedFile &&other);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief 打开并映射文件，已打开的文件会先关闭
+     * @param file_name 文件路径
+     * @param hint      读取提示
+     * @return true（成功），false（失败，错误信息已打印）
+     */
+    bool open(const char *file_name, ReadHint hint = READ_SEQUENTIAL);
+
+    /**
+     * @brief 解除映射并关闭文件
+     * @return None
+     */
+    void close();
+
+    bool is_open() const { return fd_ >= 0; }
+    const uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+
+    /**
+     * @brief 按类型访问文件内容
+     * @return 文件首地址
+     */
+    template <class T>
+    const T *as() const { return reinterpret_cast<const T *>(data_); }
+
+private:
+    int fd_;                 // 文件描述符
+    const uint8_t *data_;    // 映射地址（空文件时为nullptr）
+    size_t size_;            // 文件大小
+};
+
+/**
+ * @brief 二进制文件读取工具类
+ * 封装了带大小检查和读取提示的文件读取，可以直接读到tensor映射出来的buffer
+ */
+class BinaryIO
+{
+public:
+    /**
+     * @brief 获取文件大小
+     * @param file_name 文件路径
+     * @param size      文件大小
+     * @return true（成功），false（失败，错误信息已打印）
+     */
+    static bool file_size(const char *file_name, size_t &size);
+
+    /**
+     * @brief 读取整个文件到dst，文件大于capacity时不读取并报错
+     * @param file_name 文件路径
+     * @param dst       目标地址（如tensor map出来的buffer）
+     * @param capacity  目标地址可写大小
+     * @param read_size 实际读取大小
+     * @param hint      读取提示
+     * @return true（成功），false（失败，错误信息已打印）
+     */
+    static bool read_into(const char *file_name, void *dst, size_t capacity, size_t &read_size, ReadHint hint = READ_SEQUENTIAL);
+
+    /**
+     * @brief 读取整个文件到dst，要求文件大小与capacity完全一致（kmodel输入等固定大小数据）
+     * @param file_name 文件路径
+     * @param dst       目标地址
+     * @param capacity  目标地址大小
+     * @param hint      读取提示
+     * @return true（成功），false（失败，错误信息已打印）
+     */
+    static bool read_exact(const char *file_name, void *dst, size_t capacity, ReadHint hint = READ_SEQUENTIAL);
+
+    /**
+     * @brief 读取整个文件到vector，文件大小需为sizeof(T)的整数倍
+     * @param file_name 文件路径
+     * @param vec       输出数据
+     * @param hint      读取提示
+     * @return true（成功），false（失败，错误信息已打印）
+     */
+    template <class T>
+    static bool read_vector(const char *file_name, std::vector<T> &vec, ReadHint hint = READ_SEQUENTIAL)
+    {
+        size_t len;
+        if (!file_size(file_name, len))
+            return false;
+        if (len % sizeof(T) != 0)
+        {
+            report(file_name, "size is not a multiple of element size");
+            return false;
+        }
+        vec.resize(len / sizeof(T));
+        size_t read_size;
+        return read_into(file_name, vec.data(), len, read_size, hint) && read_size == len;
+    }
+
+private:
+    static void report(const char *file_name, const char *what);
+};
+
+#endif
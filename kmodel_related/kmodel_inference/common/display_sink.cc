@@ -0,0 +1,207 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <strings.h>
+#include "display_sink.h"
+#if K230_VIDEO_FILE_SOURCE
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+#endif
+
+#define OSD_PIXEL_SIZE (4)
+
+DisplaySink::DisplaySink(int width, int height) : width_(width), height_(height), shown_(0), failed_(0)
+{
+}
+
+DisplaySink::~DisplaySink()
+{
+}
+
+bool DisplaySink::show(int index)
+{
+    if (index < 0 || index >= (int)buffers_.size() || !present(index))
+    {
+        failed_++;
+        return false;
+    }
+    shown_++;
+    return true;
+}
+
+const std::vector<void *> &DisplaySink::buffers() const
+{
+    return buffers_;
+}
+
+int DisplaySink::width() const
+{
+    return width_;
+}
+
+int DisplaySink::height() const
+{
+    return height_;
+}
+
+uint64_t DisplaySink::shown() const
+{
+    return shown_;
+}
+
+uint64_t DisplaySink::failed() const
+{
+    return failed_;
+}
+
+size_t DisplaySink::frame_size() const
+{
+    return (size_t)width_ * height_ * OSD_PIXEL_SIZE;
+}
+
+void DisplaySink::allocate(int buffer_num)
+{
+    storage_.resize(buffer_num);
+    buffers_.clear();
+    for (auto &buffer : storage_)
+    {
+        buffer.assign(frame_size(), 0);
+        buffers_.push_back(buffer.data());
+    }
+}
+
+NullDisplaySink::NullDisplaySink(int width, int height, int buffer_num) : DisplaySink(width, height)
+{
+    allocate(buffer_num);
+}
+
+const char *NullDisplaySink::name() const
+{
+    return "null";
+}
+
+bool NullDisplaySink::present(int)
+{
+    return true;
+}
+
+struct RecordingDisplaySink::VideoWriter
+{
+#if K230_VIDEO_FILE_SOURCE
+    cv::VideoWriter writer; // 视频编码
+    cv::Mat bgr;            // ARGB8888转换后的bgr帧
+#endif
+};
+
+static bool has_suffix(const std::string &s, const char *suffix)
+{
+    size_t n = strlen(suffix);
+    return s.size() >= n && strcasecmp(s.c_str() + s.size() - n, suffix) == 0;
+}
+
+RecordingDisplaySink::RecordingDisplaySink(const std::string &path, int width, int height, int buffer_num, float fps)
+    : DisplaySink(width, height), path_(path), pattern_(path.find('%') != std::string::npos), next_index_(0)
+{
+    allocate(buffer_num);
+    if (pattern_)
+        return;
+
+    static const char *video_suffixes[] = {".avi", ".mp4", ".mkv"};
+    for (const char *suffix : video_suffixes)
+    {
+        if (!has_suffix(path_, suffix))
+            continue;
+#if K230_VIDEO_FILE_SOURCE
+        video_.reset(new VideoWriter);
+        int fourcc = has_suffix(path_, ".avi") ? cv::VideoWriter::fourcc('M', 'J', 'P', 'G') : cv::VideoWriter::fourcc('m', 'p', '4', 'v');
+        if (!video_->writer.open(path_, fourcc, fps, cv::Size(width, height)))
+        {
+            std::cerr << path_ << ": open video writer failed" << std::endl;
+            video_.reset();
+        }
+#else
+        (void)fps;
+        std::cerr << path_ << ": video recording needs opencv videoio (host build)" << std::endl;
+#endif
+        return;
+    }
+
+    file_.open(path_, std::ios::binary | std::ios::trunc);
+    if (!file_)
+        std::cerr << path_ << ": open failed" << std::endl;
+}
+
+RecordingDisplaySink::~RecordingDisplaySink()
+{
+}
+
+const char *RecordingDisplaySink::name() const
+{
+    return "record";
+}
+
+bool RecordingDisplaySink::is_open() const
+{
+    return pattern_ || video_ || file_.is_open();
+}
+
+bool RecordingDisplaySink::present(int index)
+{
+    const char *data = reinterpret_cast<const char *>(buffers_[index]);
+    if (pattern_)
+    {
+        char name[1024];
+        snprintf(name, sizeof(name), path_.c_str(), (int)next_index_++);
+        std::ofstream ofs(name, std::ios::binary | std::ios::trunc);
+        ofs.write(data, frame_size());
+        return (bool)ofs;
+    }
+#if K230_VIDEO_FILE_SOURCE
+    if (video_)
+    {
+        cv::Mat argb(height_, width_, CV_8UC4, buffers_[index]);
+        cv::cvtColor(argb, video_->bgr, cv::COLOR_BGRA2BGR);
+        video_->writer.write(video_->bgr);
+        return true;
+    }
+#endif
+    if (!file_.is_open())
+        return false;
+    file_.write(data, frame_size());
+    return (bool)file_;
+}
+
+std::unique_ptr<DisplaySink> open_display_sink(const std::string &spec, int width, int height, int buffer_num, float fps)
+{
+    if (spec == "null")
+        return std::unique_ptr<DisplaySink>(new NullDisplaySink(width, height, buffer_num));
+
+    std::unique_ptr<RecordingDisplaySink> record(new RecordingDisplaySink(spec, width, height, buffer_num, fps));
+    if (!record->is_open())
+        return nullptr;
+    return std::unique_ptr<DisplaySink>(record.release());
+}
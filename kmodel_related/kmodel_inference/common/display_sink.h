@@ -0,0 +1,193 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _DISPLAY_SINK_H
+#define _DISPLAY_SINK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief osd输出接口
+ * 提供OsdCompositor绘制用的ARGB8888 buffer，show把画好的buffer输出：vo送显、丢弃或录制到文件。
+ * 绘制与输出分开，可以单独统计绘制和送显的耗时，也可以不接显示全速运行
+ */
+class DisplaySink
+{
+public:
+    /**
+     * @brief DisplaySink构造函数
+     * @param width   osd宽
+     * @param height  osd高
+     * @return None
+     */
+    DisplaySink(int width, int height);
+
+    virtual ~DisplaySink();
+
+    /**
+     * @brief 输出一块画好的buffer
+     * @param index  buffer序号（OsdCompositor::end_frame的返回值）
+     * @return 成功返回true
+     */
+    bool show(int index);
+
+    /**
+     * @brief 输出名称，用于日志
+     * @return 名称
+     */
+    virtual const char *name() const = 0;
+
+    /**
+     * @brief osd buffer地址列表（每个width*height*4字节），用于构造OsdCompositor
+     * @return buffer列表
+     */
+    const std::vector<void *> &buffers() const;
+
+    int width() const;
+    int height() const;
+
+    /**
+     * @brief 成功输出的帧数
+     * @return 帧数
+     */
+    uint64_t shown() const;
+
+    /**
+     * @brief 输出失败的帧数
+     * @return 帧数
+     */
+    uint64_t failed() const;
+
+    /**
+     * @brief 一帧ARGB8888 osd的字节数
+     * @return width*height*4
+     */
+    size_t frame_size() const;
+
+protected:
+    /**
+     * @brief 实现具体的输出
+     * @param index  buffer序号
+     * @return 成功返回true
+     */
+    virtual bool present(int index) = 0;
+
+    /**
+     * @brief 在普通内存中分配buffer_num块osd buffer（vo以外的实现使用）
+     * @param buffer_num  buffer数
+     * @return None
+     */
+    void allocate(int buffer_num);
+
+    int width_;                             // osd宽
+    int height_;                            // osd高
+    std::vector<void *> buffers_;           // osd buffer列表
+
+private:
+    std::vector<std::vector<uint8_t>> storage_; // allocate分配的内存
+    uint64_t shown_;                        // 成功输出的帧数
+    uint64_t failed_;                       // 输出失败的帧数
+};
+
+/**
+ * @brief 丢弃输出：照常绘制但不送显，用于不接显示全速运行、单独测量绘制耗时
+ */
+class NullDisplaySink : public DisplaySink
+{
+public:
+    /**
+     * @brief NullDisplaySink构造函数
+     * @param width       osd宽
+     * @param height      osd高
+     * @param buffer_num  buffer数
+     * @return None
+     */
+    NullDisplaySink(int width, int height, int buffer_num = 2);
+
+    const char *name() const override;
+
+protected:
+    bool present(int) override;
+};
+
+/**
+ * @brief 录制输出：把每帧osd写到文件，两次运行的录制可以直接比较
+ * path含printf格式（如osd/%04d.argb，从0开始编号）时每帧一个文件，否则所有帧首尾相接写到一个文件；
+ * 每帧为width*height*4字节的ARGB8888（内存顺序B,G,R,A）；主机编译且opencv带videoio时.avi/.mp4/.mkv写成视频
+ */
+class RecordingDisplaySink : public DisplaySink
+{
+public:
+    /**
+     * @brief RecordingDisplaySink构造函数
+     * @param path        文件路径或逐帧文件的printf格式
+     * @param width       osd宽
+     * @param height      osd高
+     * @param buffer_num  buffer数
+     * @param fps         写视频时的帧率，应与show的调用频率一致（每次show写一帧）；
+     *                    ARGB文件不带时间信息，不使用该参数
+     * @return None
+     */
+    RecordingDisplaySink(const std::string &path, int width, int height, int buffer_num = 2, float fps = 30.f);
+
+    ~RecordingDisplaySink();
+
+    const char *name() const override;
+
+    /**
+     * @brief 是否打开成功
+     * @return 打开成功返回true
+     */
+    bool is_open() const;
+
+protected:
+    bool present(int index) override;
+
+private:
+    struct VideoWriter;
+
+    std::string path_;                      // 文件路径或printf格式
+    bool pattern_;                          // 是否每帧一个文件
+    unsigned long next_index_;              // 下一帧逐帧文件的编号
+    std::ofstream file_;                    // 多帧文件
+    std::unique_ptr<VideoWriter> video_;    // 视频文件（需opencv videoio）
+};
+
+/**
+ * @brief 按描述打开vo以外的输出（vo送显见vi_vo.h的display_sink_from_env）
+ * @param spec        null（丢弃）、其它为录制路径（RecordingDisplaySink）
+ * @param width       osd宽
+ * @param height      osd高
+ * @param buffer_num  buffer数
+ * @param fps         录制为视频时的帧率，应与show的调用频率一致
+ * @return 输出，打开失败返回空
+ */
+std::unique_ptr<DisplaySink> open_display_sink(const std::string &spec, int width, int height, int buffer_num = 2, float fps = 30.f);
+
+#endif
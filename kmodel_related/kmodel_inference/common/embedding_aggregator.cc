@@ -0,0 +1,140 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "embedding_aggregator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+EmbeddingAggregator::EmbeddingAggregator(int dim, int capacity, float search_drift, float max_weight)
+    : dim_(dim), capacity_(capacity), search_drift_(search_drift), max_weight_(max_weight), clock_(0),
+      track_ids_(capacity, -1), weights_(capacity), counts_(capacity), last_used_(capacity), searched_(capacity),
+      means_((size_t)capacity * dim), aggregates_((size_t)capacity * dim), search_refs_((size_t)capacity * dim)
+{
+}
+
+int EmbeddingAggregator::find(int track_id) const
+{
+    for (int i = 0; i < capacity_; i++)
+    {
+        if (track_ids_[i] == track_id)
+            return i;
+    }
+    return -1;
+}
+
+int EmbeddingAggregator::acquire(int track_id)
+{
+    int slot = find(track_id);
+    if (slot >= 0)
+        return slot;
+    slot = find(-1);
+    if (slot < 0)
+        slot = std::min_element(last_used_.begin(), last_used_.end()) - last_used_.begin();
+    track_ids_[slot] = track_id;
+    weights_[slot] = 0;
+    counts_[slot] = 0;
+    searched_[slot] = false;
+    return slot;
+}
+
+bool EmbeddingAggregator::add(int track_id, const float *embedding, float weight)
+{
+    int slot = acquire(track_id);
+    float *mean = &means_[(size_t)slot * dim_];
+    float *aggregate = &aggregates_[(size_t)slot * dim_];
+    if (weight <= 0)
+        weight = 1.f;
+
+    // mean += w / (W + w) * (e - mean)，W封顶后新帧的占比固定为w / max_weight
+    float alpha = weight / (weights_[slot] + weight);
+    if (counts_[slot] == 0)
+        memcpy(mean, embedding, sizeof(float) * dim_);
+    else
+    {
+        for (int i = 0; i < dim_; i++)
+            mean[i] += alpha * (embedding[i] - mean[i]);
+    }
+    weights_[slot] = std::min(weights_[slot] + weight, max_weight_);
+    counts_[slot]++;
+    last_used_[slot] = ++clock_;
+
+    float norm = 0;
+    for (int i = 0; i < dim_; i++)
+        norm += mean[i] * mean[i];
+    norm = norm > 0 ? 1.f / std::sqrt(norm) : 0.f;
+    for (int i = 0; i < dim_; i++)
+        aggregate[i] = mean[i] * norm;
+
+    if (!searched_[slot])
+        return true;
+    const float *ref = &search_refs_[(size_t)slot * dim_];
+    float cosine = 0;
+    for (int i = 0; i < dim_; i++)
+        cosine += aggregate[i] * ref[i];
+    return 1.f - cosine >= search_drift_;
+}
+
+const float *EmbeddingAggregator::aggregate(int track_id) const
+{
+    int slot = find(track_id);
+    return slot < 0 ? nullptr : &aggregates_[(size_t)slot * dim_];
+}
+
+int EmbeddingAggregator::count(int track_id) const
+{
+    int slot = find(track_id);
+    return slot < 0 ? 0 : counts_[slot];
+}
+
+void EmbeddingAggregator::mark_searched(int track_id)
+{
+    int slot = find(track_id);
+    if (slot < 0)
+        return;
+    memcpy(&search_refs_[(size_t)slot * dim_], &aggregates_[(size_t)slot * dim_], sizeof(float) * dim_);
+    searched_[slot] = true;
+}
+
+void EmbeddingAggregator::retain(const std::vector<FaceTrack> &tracks)
+{
+    for (int i = 0; i < capacity_; i++)
+    {
+        if (track_ids_[i] < 0)
+            continue;
+        int id = track_ids_[i];
+        if (std::none_of(tracks.begin(), tracks.end(), [id](const FaceTrack &track) { return track.id == id; }))
+        {
+            track_ids_[i] = -1;
+            last_used_[i] = 0;
+        }
+    }
+}
+
+void EmbeddingAggregator::reset()
+{
+    std::fill(track_ids_.begin(), track_ids_.end(), -1);
+    std::fill(last_used_.begin(), last_used_.end(), 0);
+}
@@ -0,0 +1,113 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _EMBEDDING_AGGREGATOR_H
+#define _EMBEDDING_AGGREGATOR_H
+
+#include <cstdint>
+#include <vector>
+#include "face_tracker.h"
+
+/**
+ * @brief 每条轨迹的人脸特征增量加权平均
+ * 单帧特征有噪声，直接查询数据库会让识别结果在相近的人之间跳变；按轨迹累积L2归一化特征的加权平均，
+ * 只有平均特征相对上次查询时变化明显才重新查询数据库
+ * 存储为固定capacity个槽位的连续数组，满了淘汰最久未更新的轨迹
+ */
+class EmbeddingAggregator
+{
+public:
+    /**
+     * @brief EmbeddingAggregator构造函数
+     * @param dim           特征长度
+     * @param capacity      最多同时聚合的轨迹数
+     * @param search_drift  平均特征与上次查询时的余弦距离（1-cos）达到该值时重新查询
+     * @param max_weight    累积权重上限，达到后相当于指数滑动平均，轨迹换人时能跟上
+     * @return None
+     */
+    EmbeddingAggregator(int dim, int capacity = 16, float search_drift = 0.02f, float max_weight = 20.f);
+
+    /**
+     * @brief 加入轨迹的一帧特征
+     * @param track_id   轨迹ID
+     * @param embedding  L2归一化后的特征
+     * @param weight     权重（如人脸质量），<=0按1处理
+     * @return 需要用aggregate()重新查询数据库时返回true（首次加入或平均特征变化明显）
+     */
+    bool add(int track_id, const float *embedding, float weight = 1.f);
+
+    /**
+     * @brief 轨迹的平均特征（已L2归一化）
+     * @param track_id  轨迹ID
+     * @return 特征指针，轨迹不存在时为nullptr
+     */
+    const float *aggregate(int track_id) const;
+
+    /**
+     * @brief 轨迹已聚合的帧数
+     * @param track_id  轨迹ID
+     * @return 帧数，轨迹不存在时为0
+     */
+    int count(int track_id) const;
+
+    /**
+     * @brief 记录已用当前平均特征查询过数据库
+     * @param track_id  轨迹ID
+     * @return None
+     */
+    void mark_searched(int track_id);
+
+    /**
+     * @brief 释放已消失轨迹的槽位
+     * @param tracks  存活的轨迹
+     * @return None
+     */
+    void retain(const std::vector<FaceTrack> &tracks);
+
+    /**
+     * @brief 清空所有槽位（如人脸数据库变化后）
+     * @return None
+     */
+    void reset();
+
+private:
+    int find(int track_id) const;
+    int acquire(int track_id);
+
+    int dim_;
+    int capacity_;
+    float search_drift_;
+    float max_weight_;
+    uint64_t clock_;                 // 每次add加1，用于淘汰最久未更新的槽位
+    std::vector<int> track_ids_;     // 槽位对应的轨迹ID，-1为空闲
+    std::vector<float> weights_;     // 累积权重
+    std::vector<int> counts_;        // 聚合帧数
+    std::vector<uint64_t> last_used_;
+    std::vector<bool> searched_;     // 是否查询过数据库
+    std::vector<float> means_;       // capacity*dim，加权平均（未归一化）
+    std::vector<float> aggregates_;  // capacity*dim，归一化后的平均特征
+    std::vector<float> search_refs_; // capacity*dim，上次查询时的平均特征
+};
+
+#endif
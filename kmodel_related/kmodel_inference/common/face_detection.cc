@@ -23,12 +23,9 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include <algorithm>
+#include <cmath>
 #include "face_detection.h"
-#include "k230_math.h"
-
-extern float kAnchors320[4200][4];
-extern float kAnchors640[16800][4];
-static float (*g_anchors)[4];
+#include "retinaface_decoder.h"
 
 cv::Scalar color_list_for_det[] = {
     cv::Scalar(0, 0, 255),
@@ -44,44 +41,48 @@ cv::Scalar color_list_for_osd_det[] = {
     cv::Scalar(255, 0, 255, 0),
     cv::Scalar(255, 255, 0, 0)};
 
-bool nms_comparator(NMSRoiObj &a, NMSRoiObj &b)
+static bool nms_comparator(const FaceDetectionInfo &a, const FaceDetectionInfo &b)
 {
-    return a.confidence > b.confidence;
+    return a.score > b.score;
 }
 
 // for image
-FaceDetection::FaceDetection(const char *kmodel_file, float obj_thresh, float nms_thresh, const int debug_mode) : obj_thresh_(obj_thresh), AIBase(kmodel_file, "FaceDetection", debug_mode)
+FaceDetection::FaceDetection(const char *kmodel_file, float obj_thresh, float nms_thresh, const int debug_mode) : AIBase(kmodel_file, "FaceDetection", debug_mode),
+    pre_process_label_(model_name_ + " pre_process video"), ai2d_label_(model_name_ + " ai2d"), post_process_label_(model_name_ + " post_process"), obj_thresh_(obj_thresh)
 {
     model_name_ = "FaceDetection";
     nms_thresh_ = nms_thresh;
 
-    int net_len = input_shapes_[0][2]; // input_shapes_[0][2]==input_shapes_[0][3]
-    g_anchors = (net_len == 320 ? kAnchors320 : kAnchors640);
     objs_num_ = output_shapes_[0][1];
+    init_decoder();
 
     ai2d_out_tensor_ = get_input_tensor(0);
 }
 
 // for video
-FaceDetection::FaceDetection(const char *kmodel_file, float obj_thresh, float nms_thresh, FrameCHWSize isp_shape, uintptr_t vaddr, uintptr_t paddr, const int debug_mode) : obj_thresh_(obj_thresh), AIBase(kmodel_file, "FaceDetection", debug_mode)
+FaceDetection::FaceDetection(const char *kmodel_file, float obj_thresh, float nms_thresh, FrameCHWSize isp_shape, uintptr_t vaddr, uintptr_t paddr, const int debug_mode, ai2d_format isp_format) : AIBase(kmodel_file, "FaceDetection", debug_mode),
+    pre_process_label_(model_name_ + " pre_process video"), ai2d_label_(model_name_ + " ai2d"), post_process_label_(model_name_ + " post_process"), obj_thresh_(obj_thresh)
 {
     model_name_ = "FaceDetection";
     nms_thresh_ = nms_thresh;
     
-    int net_len = input_shapes_[0][2]; 
-    g_anchors = (net_len == 320 ? kAnchors320 : kAnchors640);
     objs_num_ = output_shapes_[0][1];
+    init_decoder();
     vaddr_ = vaddr;
 
-    // ai2d_in_tensor to isp
+    // ai2d_in_tensor直接映射isp内存（vaddr/paddr），不再额外拷贝；人脸识别共用同一块isp内存
     isp_shape_ = isp_shape;
-    dims_t in_shape{1, isp_shape.channel, isp_shape.height, isp_shape.width};
-    int isp_size = isp_shape.channel * isp_shape.height * isp_shape.width;
-    ai2d_in_tensor_ = hrt::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("create ai2d input tensor failed");
+    isp_format_ = isp_format;
+    ai2d_in_tensor_ = create_isp_tensor(vaddr, paddr);
+    isp_tensors_.push_back({vaddr, ai2d_in_tensor_});
     ai2d_out_tensor_ = get_input_tensor(0);
 
     // fixed padding resize param
-    Utils::padding_resize_one_side(isp_shape, {input_shapes_[0][3], input_shapes_[0][2]}, ai2d_builder_, ai2d_in_tensor_, ai2d_out_tensor_, cv::Scalar(123, 117, 104));
+    if (isp_format_ == ai2d_format::YUV420_NV12)
+        Utils::padding_resize_one_side_nv12(isp_shape, {input_shapes_[0][3], input_shapes_[0][2]}, ai2d_builder_, ai2d_in_tensor_, ai2d_out_tensor_, cv::Scalar(123, 117, 104));
+    else
+        Utils::padding_resize_one_side(isp_shape, {input_shapes_[0][3], input_shapes_[0][2]}, ai2d_builder_, ai2d_in_tensor_, ai2d_out_tensor_, cv::Scalar(123, 117, 104));
+    mem_tracker_.mark("ai2d builder");
 }
 
 // ai2d for image
@@ -102,12 +103,13 @@ void FaceDetection::pre_process(cv::Mat ori_img)
 // ai2d for video
 void FaceDetection::pre_process()
 {
-    ScopedTiming st(model_name_ + " pre_process video", debug_mode_);
-    size_t isp_size = isp_shape_.channel * isp_shape_.height * isp_shape_.width;
-    auto buf = ai2d_in_tensor_.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-    memcpy(reinterpret_cast<char *>(buf.data()), (void *)vaddr_, isp_size);
-    hrt::sync(ai2d_in_tensor_, sync_op_t::sync_write_back, true).expect("sync write_back failed");
-    ai2d_builder_->invoke(ai2d_in_tensor_, ai2d_out_tensor_).expect("error occurred in ai2d running");
+    ScopedTiming st(pre_process_label_, debug_mode_);
+    // isp数据已由cpu写入vaddr，刷cache后ai2d直接读取；每帧只需要做一次，人脸识别复用
+    {
+        ScopedTiming st(ai2d_label_, debug_mode_);
+        hrt::sync(ai2d_in_tensor_, sync_op_t::sync_write_back, true).expect("sync write_back failed");
+        ai2d_builder_->invoke(ai2d_in_tensor_, ai2d_out_tensor_).expect("error occurred in ai2d running");
+    }
 
 	if (debug_mode_ > 1)
 	{
@@ -117,33 +119,79 @@ void FaceDetection::pre_process()
 	}
 }
 
+runtime_tensor FaceDetection::create_isp_tensor(uintptr_t vaddr, uintptr_t paddr)
+{
+    if (isp_format_ == ai2d_format::YUV420_NV12)
+    {
+        // nv12: y平面(h*w) + uv平面(h/2*w)，按单通道(h*3/2, w)送入ai2d
+        dims_t in_shape{1, 1, isp_shape_.height * 3 / 2, isp_shape_.width};
+        isp_size_ = isp_shape_.height * isp_shape_.width * 3 / 2;
+        return hrt::create(typecode_t::dt_uint8, in_shape, {(gsl::byte *)vaddr, isp_size_}, false, hrt::pool_shared, paddr).expect("create ai2d input tensor failed");
+    }
+    dims_t in_shape{1, isp_shape_.channel, isp_shape_.height, isp_shape_.width};
+    isp_size_ = isp_shape_.channel * isp_shape_.height * isp_shape_.width;
+    return hrt::create(typecode_t::dt_uint8, in_shape, {(gsl::byte *)vaddr, isp_size_}, false, hrt::pool_shared, paddr).expect("create ai2d input tensor failed");
+}
+
+void FaceDetection::bind_isp(uintptr_t vaddr, uintptr_t paddr)
+{
+    if (vaddr == vaddr_)
+        return;
+    vaddr_ = vaddr;
+    for (auto &t : isp_tensors_)
+    {
+        if (t.first == vaddr)
+        {
+            ai2d_in_tensor_ = t.second;
+            return;
+        }
+    }
+    // ai2d_builder只记录了输入输出的形状和参数，换输入tensor不需要重新build
+    ai2d_in_tensor_ = create_isp_tensor(vaddr, paddr);
+    isp_tensors_.push_back({vaddr, ai2d_in_tensor_});
+}
+
 void FaceDetection::inference()
 {
     this->run();
     this->get_output();
 }
 
+void FaceDetection::init_decoder()
+{
+    // input_shapes_[0][2]==input_shapes_[0][3]；640的模型使用编译期特化的解码器
+    // 导出时去掉softmax的模型输出logit，用K230_DET_SCORE指定，阈值在logit域比较
+    decoder_ = RetinaFaceDecoder::from_env(input_shapes_[0][2]);
+    if (decoder_->anchors_num() != objs_num_)
+    {
+        std::cerr << model_name_ << ": " << objs_num_ << " rois in the model output, " << decoder_->anchors_num() << " anchors for input size " << input_shapes_[0][2] << std::endl;
+        std::abort();
+    }
+    if (decoder_->score_mode() != SCORE_PROBABILITY || decoder_->use_fast_exp())
+        std::cout << model_name_ << ": score " << (decoder_->score_mode() == SCORE_SIGMOID_LOGIT ? "sigmoid" : decoder_->score_mode() == SCORE_SOFTMAX_LOGITS ? "softmax" : "prob")
+                  << (decoder_->use_fast_exp() ? ", fast exp" : "") << std::endl;
+}
+
 void FaceDetection::post_process(FrameSize frame_size, vector<FaceDetectionInfo> &results)
 {
-	ScopedTiming st(model_name_ + " post_process", debug_mode_);
+	ScopedTiming st(post_process_label_, debug_mode_);
+	candidates_.clear();
 	if (debug_mode_ > 2)
 	{
 		//排除预处理、模型推理，直接拿simulator kmodel数据，判断后处理代码正确性。
 		vector<float> out0 = Utils::read_binary_file<float>("../debug/face_det_0_k230_simu.bin");
 		vector<float> out1 = Utils::read_binary_file<float>("../debug/face_det_1_k230_simu.bin");
 		vector<float> out2 = Utils::read_binary_file<float>("../debug/face_det_2_k230_simu.bin");
-		filter_confs(out1.data());
-		filter_locs(out0.data());
-		filter_landms(out2.data());
+		decoder_->decode(out0.data(), out1.data(), out2.data(), obj_thresh_, candidates_);
 	}
 	else
 	{
-		filter_confs(p_outputs_[1]);
-		filter_locs(p_outputs_[0]);
-		filter_landms(p_outputs_[2]);
+		// 一次遍历完成阈值过滤和解码，每个候选框只解码一次
+		decoder_->decode(p_outputs_[0], p_outputs_[1], p_outputs_[2], obj_thresh_, candidates_);
 	}
 	
-	std::sort(confs_.begin(), confs_.end(), nms_comparator);
+	// 稳定排序：置信度相同时保持anchor顺序，结果可重复
+	std::stable_sort(candidates_.begin(), candidates_.end(), nms_comparator);
 	nms(results);
 	transform_result_to_src_size(frame_size, results);
 }
@@ -192,91 +240,30 @@ void FaceDetection::draw_result(cv::Mat& src_img,vector<FaceDetectionInfo>& resu
     }
 }
 
-/********************根据检测阈值kmodel数据结果***********************/
-void FaceDetection::filter_confs(float *conf)
-{
-	NMSRoiObj inter_obj;
-	confs_.clear();
-	for (uint32_t roi_index = 0; roi_index < objs_num_; roi_index++)
-	{
-		float score = conf[roi_index * CONF_SIZE + 1];
-		if (score > obj_thresh_)
-		{
-			inter_obj.ori_roi_index = roi_index;
-			inter_obj.before_sort_conf_index = confs_.size();
-			inter_obj.confidence = score;
-			confs_.push_back(inter_obj);
-		}
-	}
-}
-
-void FaceDetection::filter_locs(float *loc)
+void FaceDetection::draw_result(OsdCompositor& osd, vector<FaceDetectionInfo>& results)
 {
-	boxes_.clear();
-	boxes_.resize(confs_.size());
-	int roi_index = 0;
-	for (uint32_t conf_index = 0; conf_index < boxes_.size(); conf_index++)
-	{
-		roi_index = confs_[conf_index].ori_roi_index;
-		int start = roi_index * LOC_SIZE;
-		for (int i = 0; i < LOC_SIZE; ++i)
-		{
-			boxes_[conf_index][i] = loc[start + i];
-		}
-	}
-}
-
-void FaceDetection::filter_landms(float *landms)
-{
-	landmarks_.clear();
-	landmarks_.resize(confs_.size());
-	int roi_index = 0;
-	for (uint32_t conf_index = 0; conf_index < boxes_.size(); conf_index++)
-	{
-		roi_index = confs_[conf_index].ori_roi_index;
-		int start = roi_index * LAND_SIZE;
-		for (int i = 0; i < LAND_SIZE; ++i)
-		{
-			landmarks_[conf_index][i] = landms[start + i];
-		}
-	}
-}
-
-/********************根据anchor解码检测框、五官点***********************/
-Bbox FaceDetection::decode_box(int obj_index)
-{
-	float cx, cy, w, h;
-
-	int box_index = confs_[obj_index].before_sort_conf_index;
-	int anchor_index = confs_[obj_index].ori_roi_index;
-
-	cx = boxes_[box_index][0];
-	cy = boxes_[box_index][1];
-	w = boxes_[box_index][2];
-	h = boxes_[box_index][3];
-	cx = g_anchors[anchor_index][0] + cx * 0.1 * g_anchors[anchor_index][2];
-	cy = g_anchors[anchor_index][1] + cy * 0.1 * g_anchors[anchor_index][3];
-	w = g_anchors[anchor_index][2] * std::exp(w * 0.2);
-	h = g_anchors[anchor_index][3] * std::exp(h * 0.2);
-	Bbox box;
-	box.x = cx - w / 2;
-	box.y = cy - h / 2;
-	box.w = w;
-	box.h = h;
-	return box;
-}
+    int osd_w = osd.width();
+    int osd_h = osd.height();
+    for (int i = 0; i < results.size(); ++i)
+    {
+        auto& l = results[i].sparse_kps;
+        for (uint32_t ll = 0; ll < 5; ll++)
+        {
+            int32_t x0 = l.points[2 * ll] / isp_shape_.width * osd_w;
+            int32_t y0 = l.points[2 * ll + 1] / isp_shape_.height * osd_h;
+            osd.circle(cv::Point(x0, y0), 4, color_list_for_osd_det[ll], 8);
+        }
 
-SparseLandmarks FaceDetection::decode_landmark(int obj_index)
-{
-	SparseLandmarks landmark;
-	int landm_index = confs_[obj_index].before_sort_conf_index;
-	int anchor_index = confs_[obj_index].ori_roi_index;
-	for (uint32_t ll = 0; ll < 5; ll++)
-	{
-		landmark.points[2 * ll + 0] = g_anchors[anchor_index][0] + landmarks_[landm_index][2 * ll + 0] * 0.1 * g_anchors[anchor_index][2];
-		landmark.points[2 * ll + 1] = g_anchors[anchor_index][1] + landmarks_[landm_index][2 * ll + 1] * 0.1 * g_anchors[anchor_index][3];
-	}
-	return landmark;
+        auto& b = results[i].bbox;
+        char text[10];
+        sprintf(text, "%.2f", results[i].score);
+        int x = b.x / isp_shape_.width * osd_w;
+        int y = b.y / isp_shape_.height * osd_h;
+        int w = b.w / isp_shape_.width * osd_w;
+        int h = b.h / isp_shape_.height * osd_h;
+        osd.rectangle(cv::Rect(x, y, w, h), cv::Scalar(255, 255, 255, 255), 6);
+        osd.put_text(text, {x, y}, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(255, 0, 255, 255), 1);
+    }
 }
 
 /********************iou计算***********************/
@@ -317,25 +304,21 @@ float FaceDetection::box_iou(Bbox a, Bbox b)
 /********************nms***********************/
 void FaceDetection::nms(vector<FaceDetectionInfo> &results)
 {
-	// nms
-	for (int conf_index = 0; conf_index < confs_.size(); ++conf_index)
+	// nms，被抑制的候选框score置为-1
+	for (int i = 0; i < candidates_.size(); ++i)
 	{
-		if (confs_[conf_index].confidence < 0)
+		if (candidates_[i].score < 0)
 			continue;
 
-		FaceDetectionInfo obj;
-		obj.bbox = decode_box(conf_index);
-		obj.sparse_kps = decode_landmark(conf_index);
-		obj.score = confs_[conf_index].confidence;
+		const FaceDetectionInfo &obj = candidates_[i];
 		results.push_back(obj);
 
-		for (int j = conf_index + 1; j < confs_.size(); ++j)
+		for (int j = i + 1; j < candidates_.size(); ++j)
 		{
-			if (confs_[j].confidence < 0)
+			if (candidates_[j].score < 0)
 				continue;
-			Bbox b = decode_box(j);
-			if (box_iou(obj.bbox, b) >= nms_thresh_) // iou大于nms阈值的，之后循环将会忽略
-				confs_[j].confidence = -1;
+			if (box_iou(obj.bbox, candidates_[j].bbox) >= nms_thresh_) // iou大于nms阈值的，之后循环将会忽略
+				candidates_[j].score = -1;
 		}
 	}
 }
@@ -26,11 +26,13 @@
 #define _FACE_DETECTION_H
 
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <array>
 
 #include "utils.h"
 #include "ai_base.h"
+#include "osd_compositor.h"
 
 using std::vector;
 using std::array;
@@ -39,15 +41,7 @@ using std::array;
 #define CONF_SIZE 2
 #define LAND_SIZE 10
 
-/**
- * @brief 用于NMS排序的roi对象
- */
-typedef struct NMSRoiObj
-{
-	int ori_roi_index;				 // 从kmodel到得到roi原始类别索引，用于过滤locs、landms；nms时定位anchor
-	int before_sort_conf_index;           // roi对象所在过滤后的conf列表索引，用于记录sort之后conf，在未sort时conf位置，用于nms时定位locs、landms
-	float confidence;    // roi对象的置信度
-} NMSRoiObj;
+class RetinaFaceDecoder;
 
 /**
  * @brief 人脸五官点
@@ -95,9 +89,10 @@ public:
      * @param vaddr       isp对应虚拟地址
      * @param paddr       isp对应物理地址
      * @param debug_mode  0（不调试）、 1（只显示时间）、2（显示所有打印信息）
+     * @param isp_format  isp数据格式，NCHW_FMT（rgb888 planar）或YUV420_NV12
      * @return None
      */
-    FaceDetection(const char *kmodel_file, float obj_thresh,float nms_thresh, FrameCHWSize isp_shape, uintptr_t vaddr, uintptr_t paddr, const int debug_mode);
+    FaceDetection(const char *kmodel_file, float obj_thresh,float nms_thresh, FrameCHWSize isp_shape, uintptr_t vaddr, uintptr_t paddr, const int debug_mode, ai2d_format isp_format = ai2d_format::NCHW_FMT);
 
     /**
      * @brief FaceDetection析构函数
@@ -113,11 +108,20 @@ public:
     void pre_process(cv::Mat ori_img);
 
     /**
-     * @brief 视频流预处理（ai2d for video）
+     * @brief 视频流预处理（ai2d for video），isp内存每帧在这里统一刷cache，之后人脸识别可直接使用
      * @return None
      */
     void pre_process();
 
+    /**
+     * @brief 把ai2d输入切换到另一块同尺寸、同格式的isp内存，多路流共用一个模型时在pre_process前调用；
+     *        每块内存的ai2d输入tensor只创建一次，之后切换不再分配
+     * @param vaddr  isp对应虚拟地址
+     * @param paddr  isp对应物理地址
+     * @return None
+     */
+    void bind_isp(uintptr_t vaddr, uintptr_t paddr);
+
     /**
      * @brief kmodel推理
      * @return None
@@ -141,43 +145,20 @@ public:
      */
     void draw_result(cv::Mat& src_img,vector<FaceDetectionInfo>& results, bool pic_mode = true);
 
-private:   
-    /********************根据检测阈值kmodel数据结果***********************/
-    /**
-     * @brief 根据检测阈值过滤roi置信度
-     * @param confs    kmodel输入结果，confs
-     * @return None
-     */
-    void filter_confs(float *confs);
-
-    /**
-     * @brief 根据检测阈值过滤roi loc
-     * @param locs     kmodel输入结果，locs
-     * @return None
-     */
-    void filter_locs(float *locs);
-
-    /**
-     * @brief 根据检测阈值过滤roi landms
-     * @param landms  kmodel输入结果，landms
-     * @return None
-     */
-    void filter_landms(float *landms);
-
-    /********************根据anchor解码***********************/
     /**
-     * @brief 根据anchor解码人脸检测框
-     * @param obj_index   需要获取的roi索引
+     * @brief 将检测结果画到osd，只清除和重画变化的区域
+     * @param osd         osd合成器（已调用begin_frame）
+     * @param results     人脸检测结果
      * @return None
      */
-    Bbox decode_box(int obj_index);
+    void draw_result(OsdCompositor& osd, vector<FaceDetectionInfo>& results);
 
+private:   
     /**
-     * @brief 根据anchor解码人脸关键点
-     * @param obj_index   需要获取的roi索引
+     * @brief 按模型输入边长创建解码器，并检查anchor个数与模型输出一致
      * @return None
      */
-    SparseLandmarks decode_landmark(int obj_index);
+    void init_decoder();
 
     /********************iou计算***********************/
     /**
@@ -216,7 +197,7 @@ private:
 
     /********************nms***********************/
     /**
-     * @brief nms
+     * @brief nms，候选框已按置信度从高到低排序且已解码
      * @param results     后处理之后的基于原始图像比例(0~1)的{检测框、五官点和得分}集合
      * @return None
      */
@@ -231,19 +212,33 @@ private:
     void transform_result_to_src_size(FrameSize &frame_size, vector<FaceDetectionInfo> &results);
 
 private:
+    /**
+     * @brief 为一块isp内存创建ai2d输入tensor（直接映射，不拷贝）
+     * @param vaddr  isp对应虚拟地址
+     * @param paddr  isp对应物理地址
+     * @return ai2d输入tensor
+     */
+    runtime_tensor create_isp_tensor(uintptr_t vaddr, uintptr_t paddr);
+
     std::unique_ptr<ai2d_builder> ai2d_builder_; // ai2d构建器
     runtime_tensor ai2d_in_tensor_;              // ai2d输入tensor
+    vector<std::pair<uintptr_t, runtime_tensor>> isp_tensors_; // 已绑定过的isp内存及其ai2d输入tensor
     runtime_tensor ai2d_out_tensor_;             // ai2d输出tensor
     uintptr_t vaddr_;                            // isp的虚拟地址
     FrameCHWSize isp_shape_;                     // isp对应的地址大小
+    ai2d_format isp_format_;                     // isp数据格式
+    size_t isp_size_;                            // isp数据大小（字节）
+
+    TimingLabel pre_process_label_;              // 视频流pre_process计时名称，构造时拼接一次
+    TimingLabel ai2d_label_;                     // ai2d计时名称
+    TimingLabel post_process_label_;             // post_process计时名称
 
     float obj_thresh_; // 人脸检测阈值
     float nms_thresh_; // nms阈值
     int objs_num_;     // roi个数
 
-	vector<NMSRoiObj> confs_;                    // 根据obj_thresh_过滤后的得分列表
-	vector<array<float, LOC_SIZE>> boxes_;       // 根据obj_thresh_过滤后roi检测框列表
-	vector<array<float, LAND_SIZE>> landmarks_;  // 根据obj_thresh_过滤后roi对应五官点列表
+    std::unique_ptr<RetinaFaceDecoder> decoder_; // 按输入边长特化的anchor解码器
+    vector<FaceDetectionInfo> candidates_;       // 置信度超过obj_thresh_、已解码的候选框
 };
 
 #endif
\ No newline at end of file
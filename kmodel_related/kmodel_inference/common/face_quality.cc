@@ -0,0 +1,161 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "face_quality.h"
+
+#include <algorithm>
+#include <cmath>
+
+static float clamp01(float v)
+{
+    return std::min(1.f, std::max(0.f, v));
+}
+
+float FaceQuality::frontal(const SparseLandmarks &kps)
+{
+    const float *p = kps.points;
+    float eye_dx = p[2] - p[0];
+    float eye_dy = p[3] - p[1];
+    float eye_dist = std::sqrt(eye_dx * eye_dx + eye_dy * eye_dy);
+    if (eye_dist < 1.f)
+        return 0;
+
+    // 偏航：鼻尖偏离两眼中点的水平距离，侧到半个眼距时为0
+    float eye_cx = (p[0] + p[2]) / 2;
+    float eye_cy = (p[1] + p[3]) / 2;
+    float yaw = 1.f - clamp01(std::fabs(p[4] - eye_cx) / (0.5f * eye_dist));
+
+    // 翻滚：两眼连线的倾角，30度时为0
+    float roll = 1.f - clamp01(std::fabs(std::atan2(eye_dy, eye_dx)) / (30.f * 3.1415926f / 180.f));
+
+    // 俯仰：鼻尖在眼睛与嘴角之间的相对高度，正脸约为0.5
+    float mouth_cy = (p[7] + p[9]) / 2;
+    float pitch = 0;
+    if (mouth_cy - eye_cy > 1.f)
+        pitch = 1.f - clamp01(std::fabs((p[5] - eye_cy) / (mouth_cy - eye_cy) - 0.5f) / 0.35f);
+    return yaw * roll * pitch;
+}
+
+float FaceQuality::sharpness(const uint8_t *luma, int width, int height, int stride, const Bbox &bbox)
+{
+    int x0 = std::max(1, (int)bbox.x);
+    int y0 = std::max(1, (int)bbox.y);
+    int x1 = std::min(width - 2, (int)(bbox.x + bbox.w));
+    int y1 = std::min(height - 2, (int)(bbox.y + bbox.h));
+    if (x1 <= x0 || y1 <= y0)
+        return 0;
+
+    // 框内均匀取最多32x32个点，每点用上下左右相邻像素算拉普拉斯
+    int step_x = std::max(1, (x1 - x0) / 32);
+    int step_y = std::max(1, (y1 - y0) / 32);
+    double sum = 0, sum_sq = 0;
+    int n = 0;
+    for (int y = y0; y <= y1; y += step_y)
+    {
+        const uint8_t *row = luma + (size_t)y * stride;
+        for (int x = x0; x <= x1; x += step_x)
+        {
+            int lap = 4 * row[x] - row[x - 1] - row[x + 1] - row[x - stride] - row[x + stride];
+            sum += lap;
+            sum_sq += (double)lap * lap;
+            n++;
+        }
+    }
+    double mean = sum / n;
+    double var = sum_sq / n - mean * mean;
+    // 方差为100时得分0.5，经验值，8bit图像模糊人脸一般在几十以内
+    return (float)(var / (var + 100.0));
+}
+
+FaceQualityInfo FaceQuality::score(const FaceDetectionInfo &det, float sharpness, int target_size)
+{
+    FaceQualityInfo q;
+    q.det = clamp01((det.score - 0.5f) / 0.5f);
+    q.size = clamp01(std::min(det.bbox.w, det.bbox.h) / target_size);
+    q.frontal = frontal(det.sparse_kps);
+    q.sharpness = clamp01(sharpness);
+    // 角度对识别影响最大，其次是清晰度
+    q.total = 0.15f * q.det + 0.2f * q.size + 0.4f * q.frontal + 0.25f * q.sharpness;
+    return q;
+}
+
+BestFaceWindow::BestFaceWindow(int window, float good_enough) : window_(std::max(1, window)), good_enough_(good_enough)
+{
+}
+
+bool BestFaceWindow::offer(int track_id, float quality)
+{
+    auto it = windows_.find(track_id);
+    if (it == windows_.end())
+    {
+        windows_[track_id] = {1, quality, {}};
+        return true;
+    }
+    Window &w = it->second;
+    w.frames++;
+    if (quality > w.best)
+    {
+        w.best = quality;
+        return true;
+    }
+    return false;
+}
+
+std::vector<uint8_t> &BestFaceWindow::crop(int track_id)
+{
+    return windows_[track_id].crop;
+}
+
+bool BestFaceWindow::ready(int track_id) const
+{
+    auto it = windows_.find(track_id);
+    if (it == windows_.end())
+        return false;
+    return it->second.frames >= window_ || it->second.best >= good_enough_;
+}
+
+float BestFaceWindow::best(int track_id) const
+{
+    auto it = windows_.find(track_id);
+    return it == windows_.end() ? 0.f : it->second.best;
+}
+
+void BestFaceWindow::finish(int track_id)
+{
+    windows_.erase(track_id);
+}
+
+void BestFaceWindow::retain(const std::vector<FaceTrack> &tracks)
+{
+    for (auto it = windows_.begin(); it != windows_.end();)
+    {
+        bool alive = std::any_of(tracks.begin(), tracks.end(), [&](const FaceTrack &track) { return track.id == it->first; });
+        it = alive ? std::next(it) : windows_.erase(it);
+    }
+}
+
+size_t BestFaceWindow::size() const
+{
+    return windows_.size();
+}
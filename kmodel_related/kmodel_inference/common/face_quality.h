@@ -0,0 +1,155 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _FACE_QUALITY_H
+#define _FACE_QUALITY_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "face_detection.h"
+#include "face_tracker.h"
+
+/**
+ * @brief 人脸质量各项得分，均为0~1
+ */
+typedef struct FaceQualityInfo
+{
+    float det;       // 检测置信度
+    float size;      // 人脸大小（短边相对识别输入边长）
+    float frontal;   // 正脸程度（由五官点估计的偏航、翻滚、俯仰）
+    float sharpness; // 清晰度（拉普拉斯方差）
+    float total;     // 加权总分
+} FaceQualityInfo;
+
+/**
+ * @brief 人脸质量评估，只用人脸检测已有的结果和少量像素，不跑额外的kmodel
+ */
+class FaceQuality
+{
+public:
+    /**
+     * @brief 由五官点估计正脸程度
+     * @param kps  人脸五官点
+     * @return 0~1，1为正脸
+     */
+    static float frontal(const SparseLandmarks &kps);
+
+    /**
+     * @brief 人脸框内亮度的清晰度，在框内取最多32x32个采样点计算拉普拉斯方差
+     * @param luma    亮度平面（rgb planar可直接传g平面）
+     * @param width   宽
+     * @param height  高
+     * @param stride  行跨度（字节）
+     * @param bbox    人脸框
+     * @return 0~1，越大越清晰
+     */
+    static float sharpness(const uint8_t *luma, int width, int height, int stride, const Bbox &bbox);
+
+    /**
+     * @brief 综合质量
+     * @param det          人脸检测结果
+     * @param sharpness    sharpness()的结果
+     * @param target_size  识别kmodel输入边长，人脸短边达到该值时大小得分为1
+     * @return 各项得分及加权总分
+     */
+    static FaceQualityInfo score(const FaceDetectionInfo &det, float sharpness, int target_size = 112);
+};
+
+/**
+ * @brief 每条轨迹在window帧内只保留质量最好的一帧人脸（对齐后的识别输入），窗口结束时只识别这一帧
+ */
+class BestFaceWindow
+{
+public:
+    /**
+     * @brief BestFaceWindow构造函数
+     * @param window       窗口帧数，1表示每次都立即识别
+     * @param good_enough  质量达到该值时不再等待，立即识别
+     * @return None
+     */
+    BestFaceWindow(int window = 5, float good_enough = 0.85f);
+
+    /**
+     * @brief 提交轨迹本帧的人脸质量，没有窗口时打开新窗口
+     * @param track_id  轨迹ID
+     * @param quality   质量总分
+     * @return 本帧是窗口内最好的一帧时返回true，调用者需把对齐后的人脸保存到crop(track_id)
+     */
+    bool offer(int track_id, float quality);
+
+    /**
+     * @brief 轨迹窗口内最好一帧的对齐人脸
+     * @param track_id  轨迹ID
+     * @return 保存数据的buffer
+     */
+    std::vector<uint8_t> &crop(int track_id);
+
+    /**
+     * @brief 窗口是否结束（满window帧或最好质量达到good_enough）
+     * @param track_id  轨迹ID
+     * @return 结束返回true
+     */
+    bool ready(int track_id) const;
+
+    /**
+     * @brief 轨迹窗口内最好一帧的质量
+     * @param track_id  轨迹ID
+     * @return 质量总分，没有窗口时为0
+     */
+    float best(int track_id) const;
+
+    /**
+     * @brief 识别完成后关闭轨迹的窗口
+     * @param track_id  轨迹ID
+     * @return None
+     */
+    void finish(int track_id);
+
+    /**
+     * @brief 删除已消失轨迹的窗口
+     * @param tracks  存活的轨迹
+     * @return None
+     */
+    void retain(const std::vector<FaceTrack> &tracks);
+
+    /**
+     * @brief 打开的窗口数
+     */
+    size_t size() const;
+
+private:
+    struct Window
+    {
+        int frames;
+        float best;
+        std::vector<uint8_t> crop;
+    };
+
+    int window_;
+    float good_enough_;
+    std::map<int, Window> windows_;
+};
+
+#endif
@@ -1,193 +1,295 @@
-/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- * 1. Redistributions of source code must retain the above copyright
- * notice, this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- * notice, this list of conditions and the following disclaimer in the
- * documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
- * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
- * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
- * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
- * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
- * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
- * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
- * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-#ifndef _FACE_REGISTRATION_H
-#define _FACE_REGISTRATION_H
-
-#include <vector>
-#include "utils.h"
-#include "ai_base.h"
-
-using std::vector;
-
-typedef struct FaceRecognitionInfo
-{
-    int id;                     //人脸识别结果对应ID
-    float score;                //人脸识别结果对应得分
-    string name;                //人脸识别结果对应人名
-} FaceRecognitionInfo;
-
-/**
- * @brief 基于Retinaface的人脸检测
- * 主要封装了对于每一帧图片，从预处理、运行到后处理给出结果的过程
- */
-class FaceRecognition : public AIBase
-{
-public:
-    /**
-     * @brief FaceRecognition构造函数，加载kmodel,并初始化kmodel输入、输出(for image)
-     * @param kmodel_file       kmodel文件路径
-     * @param max_register_face 数据库最多可以存放的人脸特征数
-     * @param thresh            人脸识别阈值
-     * @param debug_mode        0（不调试）、 1（只显示时间）、2（显示所有打印信息）
-     * @return None
-     */
-    FaceRecognition(const char *kmodel_file, int max_register_face, float thresh, const int debug_mode);
-
-    /**
-     * @brief FaceRecognition构造函数，加载kmodel,并初始化kmodel输入、输出和人脸检测阈值(for isp)
-     * @param kmodel_file       kmodel文件路径
-     * @param max_register_face 数据库最多可以存放的人脸特征数
-     * @param thresh            人脸识别阈值
-     * @param isp_shape         isp输入大小（chw）
-     * @param vaddr             isp对应虚拟地址
-     * @param paddr             isp对应物理地址
-     * @param debug_mode        0（不调试）、 1（只显示时间）、2（显示所有打印信息）
-     * @return None
-     */
-    FaceRecognition(const char *kmodel_file,int max_register_face, float thresh, FrameCHWSize isp_shape, uintptr_t vaddr, uintptr_t paddr, const int debug_mode);
-
-    /**
-     * @brief FaceRecognition析构函数
-     * @return None
-     */
-    ~FaceRecognition();
-
-    /**
-     * @brief 图片预处理        （ai2d for image）
-     * @param ori_img          原始图片
-     * @param sparse_points    原始人脸检测框对应的五官点
-     * @return None
-     */
-    void pre_process(cv::Mat ori_img, float* sparse_points);
-
-    /**
-     * @brief 视频流预处理（ai2d for video）
-     * @param sparse_points    原始人脸检测框对应的五官点
-     * @return None
-     */
-    void pre_process(float* sparse_points);
-
-    /**
-     * @brief kmodel推理
-     * @return None
-     */
-    void inference();
-
-    //for database
-    /**
-     * @brief 人脸数据库加载接口
-     * @param db_pth 数据库目录
-     * @return None
-     */
-    // void database_init();
-    void database_init(char *db_pth);
-
-    /**
-     * @brief 人脸数据库注册接口
-     * @param db_pth 数据库目录
-     * @return None
-     */
-    void database_insert(char *db_pth);
-
-    /**
-     * @brief 人脸数据库重置接口
-     * @param db_pth 数据库目录
-     * @return None
-     */
-    void database_reset(char *db_pth);
-
-    /**
-     * @brief 人脸数据库查询接口
-     * @param result 人脸识别结果
-     * @return None
-     */
-    void database_search(FaceRecognitionInfo& result);
-
-    /**
-     * @brief 将处理好的轮廓画到原图
-     * @param src_img     原图
-     * @param bbox        识别人脸的检测框位置
-     * @param result      人脸识别结果
-     * @param pic_mode    ture(原图片)，false(osd)
-     * @return None
-     */
-    void draw_result(cv::Mat& src_img,Bbox& bbox,FaceRecognitionInfo& result, bool pic_mode=true);
-
-private:
-    /** 
-     * @brief svd
-     * @param a     原始矩阵
-     * @param u     左奇异向量
-     * @param s     对角阵
-     * @param v     右奇异向量
-     * @return None
-     */
-    void svd22(const float a[4], float u[4], float s[2], float v[4]);
-    
-    /**
-    * @brief 使用Umeyama算法计算仿射变换矩阵
-    * @param src  原图像点位置
-    * @param dst  目标图像（112*112）点位置。
-    */
-    void image_umeyama_112(float* src, float* dst);
-
-    /**
-    * @brief 获取affine变换矩阵
-    * @param sparse_points  原图像人脸五官点位置
-    */
-    void get_affine_matrix(float* sparse_points);
-
-    /**
-    * @brief 使用L2范数对数据进行归一化
-    * @param src  原始数据
-    * @param dst  L2归一化后的数据
-    * @param len  原始数据长度
-    */
-    void l2_normalize(float* src, float* dst, int len);
-
-    /**
-    * @brief 计算两特征的余弦距离
-    * @param feature_0    第一个特征
-    * @param feature_1    第二个特征
-    * @param feature_len  特征长度
-    */
-    float cal_cosine_distance(float* feature_0, float* feature_1, int feature_len);
-
-    std::unique_ptr<ai2d_builder> ai2d_builder_; // ai2d构建器
-    runtime_tensor ai2d_in_tensor_;              // ai2d输入tensor
-    runtime_tensor ai2d_out_tensor_;             // ai2d输出tensor
-    
-    uintptr_t vaddr_;                            // isp的虚拟地址
-    FrameCHWSize isp_shape_;                     // isp对应的地址大小
-    float matrix_dst_[10];                       // 人脸affine的变换矩阵
-    float obj_thresh_;                            // 人脸识别阈值
-    int max_register_face_;                       // 数据库中最大存储人脸个数
-    int feature_num_;                             // 人脸识别提取特征长度
-public:
-    float *feature_database_;                     // 人脸数据库数据
-    vector<string> names_;                        // 人脸数据库名字
-    int valid_register_face_;                     // 数据库中实际人脸个数
-};
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _FACE_REGISTRATION_H
+#define _FACE_REGISTRATION_H
+
+#include <vector>
+#include <map>
+#include "utils.h"
+#include "ai_base.h"
+#include "osd_compositor.h"
+
+using std::vector;
+
+typedef struct FaceRecognitionInfo
+{
+    int id;                     //人脸识别结果对应ID
+    float score;                //人脸识别结果对应得分
+    string name;                //人脸识别结果对应人名
+} FaceRecognitionInfo;
+
+/**
+ * @brief 视频流人脸affine的实现方式
+ * AFFINE_AI2D：每个人脸重建ai2d_builder并由ai2d执行；AFFINE_CPU：cpu直接从isp内存采样到kmodel输入，不构建ai2d_builder
+ */
+enum AffineMode
+{
+    AFFINE_AI2D = 0,
+    AFFINE_CPU = 1,
+};
+
+/**
+ * @brief 基于Retinaface的人脸检测
+ * 主要封装了对于每一帧图片，从预处理、运行到后处理给出结果的过程
+ */
+class FaceRecognition : public AIBase
+{
+public:
+    /**
+     * @brief FaceRecognition构造函数，加载kmodel,并初始化kmodel输入、输出(for image)
+     * @param kmodel_file       kmodel文件路径
+     * @param max_register_face 数据库最多可以存放的人脸特征数
+     * @param thresh            人脸识别阈值
+     * @param debug_mode        0（不调试）、 1（只显示时间）、2（显示所有打印信息）
+     * @return None
+     */
+    FaceRecognition(const char *kmodel_file, int max_register_face, float thresh, const int debug_mode);
+
+    /**
+     * @brief FaceRecognition构造函数，加载kmodel,并初始化kmodel输入、输出和人脸检测阈值(for isp)
+     * @param kmodel_file       kmodel文件路径
+     * @param max_register_face 数据库最多可以存放的人脸特征数
+     * @param thresh            人脸识别阈值
+     * @param isp_shape         isp输入大小（chw）
+     * @param vaddr             isp对应虚拟地址
+     * @param paddr             isp对应物理地址
+     * @param debug_mode        0（不调试）、 1（只显示时间）、2（显示所有打印信息）
+     * @return None
+     */
+    FaceRecognition(const char *kmodel_file,int max_register_face, float thresh, FrameCHWSize isp_shape, uintptr_t vaddr, uintptr_t paddr, const int debug_mode);
+
+    /**
+     * @brief FaceRecognition析构函数
+     * @return None
+     */
+    ~FaceRecognition();
+
+    /**
+     * @brief 图片预处理        （ai2d for image）
+     * @param ori_img          原始图片
+     * @param sparse_points    原始人脸检测框对应的五官点
+     * @return None
+     */
+    void pre_process(cv::Mat ori_img, float* sparse_points);
+
+    /**
+     * @brief 视频流预处理（ai2d for video），isp内存与人脸检测共用，需在FaceDetection::pre_process之后调用
+     * @param sparse_points    原始人脸检测框对应的五官点
+     * @return None
+     */
+    void pre_process(float* sparse_points);
+
+    /**
+     * @brief 切换到另一块同尺寸的isp内存（多路流共用一个识别模型），与FaceDetection::bind_isp配合使用
+     * @param vaddr  isp对应虚拟地址
+     * @param paddr  isp对应物理地址
+     * @return None
+     */
+    void bind_isp(uintptr_t vaddr, uintptr_t paddr);
+
+    /**
+     * @brief 设置视频流预处理是否只对人脸所在区域做affine
+     * @param enable  true（拷贝人脸所在区域到小tensor后affine），false（默认，对已刷过cache的整帧isp数据affine，不拷贝）
+     * @return None
+     */
+    void set_roi_crop(bool enable);
+
+    /**
+     * @brief 设置视频流预处理affine的实现方式
+     * @param mode  AFFINE_AI2D（默认）或AFFINE_CPU，两者的耗时对比见test_demo/test_preprocess
+     * @return None
+     */
+    void set_affine_mode(AffineMode mode);
+
+    /**
+     * @brief 按名称设置视频流人脸affine的方式（K230_AFFINE），便于不改代码对比单个人脸的预处理耗时
+     * @param spec  ai2d（默认，整帧affine）、ai2d_roi（拷贝人脸roi后affine）、cpu（cpu采样，不构建ai2d_builder）
+     * @return 名称可识别返回true
+     */
+    bool set_affine(const string &spec);
+
+    /**
+     * @brief 保存pre_process得到的kmodel输入（对齐后的人脸），用于在质量更好的一帧出现前先存起来、稍后再识别
+     * @param aligned  保存的数据
+     * @return None
+     */
+    void save_aligned(vector<uint8_t> &aligned);
+
+    /**
+     * @brief 把save_aligned保存的数据写回kmodel输入，之后直接调用inference
+     * @param aligned  save_aligned保存的数据
+     * @return None
+     */
+    void load_aligned(const vector<uint8_t> &aligned);
+
+    /**
+     * @brief kmodel推理
+     * @return None
+     */
+    void inference();
+
+    //for database
+    /**
+     * @brief 人脸数据库加载接口
+     * @param db_pth 数据库目录
+     * @return None
+     */
+    // void database_init();
+    void database_init(char *db_pth);
+
+    /**
+     * @brief 人脸数据库注册接口
+     * @param db_pth 数据库目录
+     * @return None
+     */
+    void database_insert(char *db_pth);
+
+    /**
+     * @brief 人脸数据库重置接口
+     * @param db_pth 数据库目录
+     * @return None
+     */
+    void database_reset(char *db_pth);
+
+    /**
+     * @brief 人脸数据库查询接口
+     * @param result 人脸识别结果
+     * @return None
+     */
+    void database_search(FaceRecognitionInfo& result);
+
+    /**
+     * @brief 用给定特征查询人脸数据库（如EmbeddingAggregator按轨迹聚合后的特征）
+     * @param embedding  L2归一化后的特征，长度为feature_num()
+     * @param result     人脸识别结果
+     * @return None
+     */
+    void database_search(const float* embedding, FaceRecognitionInfo& result);
+
+    /**
+     * @brief 获取最近一次inference的L2归一化特征
+     * @param embedding  输出，长度为feature_num()
+     * @return None
+     */
+    void get_embedding(float* embedding);
+
+    /**
+     * @brief 人脸识别特征长度
+     * @return 特征长度
+     */
+    int feature_num() const;
+
+    /**
+     * @brief 将处理好的轮廓画到原图
+     * @param src_img     原图
+     * @param bbox        识别人脸的检测框位置
+     * @param result      人脸识别结果
+     * @param pic_mode    ture(原图片)，false(osd)
+     * @return None
+     */
+    void draw_result(cv::Mat& src_img,Bbox& bbox,FaceRecognitionInfo& result, bool pic_mode=true);
+
+    /**
+     * @brief 将识别结果画到osd，只清除和重画变化的区域
+     * @param osd         osd合成器（已调用begin_frame）
+     * @param bbox        识别人脸的检测框位置
+     * @param result      人脸识别结果
+     * @return None
+     */
+    void draw_result(OsdCompositor& osd,Bbox& bbox,FaceRecognitionInfo& result);
+
+private:
+    /** 
+     * @brief svd
+     * @param a     原始矩阵
+     * @param u     左奇异向量
+     * @param s     对角阵
+     * @param v     右奇异向量
+     * @return None
+     */
+    void svd22(const float a[4], float u[4], float s[2], float v[4]);
+    
+    /**
+    * @brief 使用Umeyama算法计算仿射变换矩阵
+    * @param src  原图像点位置
+    * @param dst  目标图像（112*112）点位置。
+    */
+    void image_umeyama_112(float* src, float* dst);
+
+    /**
+    * @brief 获取affine变换矩阵
+    * @param sparse_points  原图像人脸五官点位置
+    */
+    void get_affine_matrix(float* sparse_points);
+
+    /**
+    * @brief 根据affine矩阵反算112*112输出在原图上的采样区域，并对齐到固定大小的正方形roi
+    * @param roi_x    roi左上角x
+    * @param roi_y    roi左上角y
+    * @param roi_size roi边长，为kRoiSizes中的一档
+    * @return true（可以使用roi），false（人脸区域过大，使用整帧）
+    */
+    bool get_affine_roi(int &roi_x, int &roi_y, int &roi_size);
+
+    /**
+    * @brief 使用L2范数对数据进行归一化
+    * @param src  原始数据
+    * @param dst  L2归一化后的数据
+    * @param len  原始数据长度
+    */
+    void l2_normalize(float* src, float* dst, int len);
+
+    /**
+    * @brief 计算两特征的余弦距离
+    * @param feature_0    第一个特征
+    * @param feature_1    第二个特征
+    * @param feature_len  特征长度
+    */
+    float cal_cosine_distance(const float* feature_0, const float* feature_1, int feature_len);
+
+    std::unique_ptr<ai2d_builder> ai2d_builder_; // ai2d构建器
+    runtime_tensor ai2d_in_tensor_;              // ai2d输入tensor
+    runtime_tensor ai2d_out_tensor_;             // ai2d输出tensor
+    
+    uintptr_t vaddr_;                            // isp的虚拟地址
+    vector<std::pair<uintptr_t, runtime_tensor>> isp_tensors_; // 已绑定过的isp内存及其ai2d输入tensor
+    FrameCHWSize isp_shape_;                     // isp对应的地址大小
+    bool roi_crop_;                              // 是否只对人脸区域做affine
+    AffineMode affine_mode_;                     // 视频流affine实现方式
+    std::map<int, runtime_tensor> roi_tensors_;  // 按roi边长缓存的ai2d输入tensor
+    float matrix_dst_[10];                       // 人脸affine的变换矩阵
+    TimingLabel pre_process_label_;              // 视频流pre_process计时名称，构造时拼接一次
+    TimingLabel ai2d_label_;                     // ai2d计时名称
+    TimingLabel database_search_label_;          // database_search计时名称
+    float obj_thresh_;                            // 人脸识别阈值
+    int max_register_face_;                       // 数据库中最大存储人脸个数
+    int feature_num_;                             // 人脸识别提取特征长度
+public:
+    float *feature_database_;                     // 人脸数据库数据
+    float *normalized_database_;                  // 归一化后的人脸数据库，加载、注册时算一次，查询时不再逐条归一化
+    vector<string> names_;                        // 人脸数据库名字
+    int valid_register_face_;                     // 数据库中实际人脸个数
+};
 #endif
\ No newline at end of file
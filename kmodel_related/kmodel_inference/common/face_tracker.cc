@@ -0,0 +1,290 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "face_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// 噪声参数与SORT一致：观测的面积、宽高比噪声大，速度的过程噪声小
+static const float kMeasureNoise[4] = {1.f, 1.f, 10.f, 10.f};
+static const float kProcessNoise[7] = {1.f, 1.f, 1.f, 1.f, 0.01f, 0.01f, 0.0001f};
+
+KalmanBox::KalmanBox(const Bbox &bbox)
+{
+    float cx = bbox.x + bbox.w / 2;
+    float cy = bbox.y + bbox.h / 2;
+    float s = bbox.w * bbox.h;
+    float r = bbox.h > 0 ? bbox.w / bbox.h : 1.f;
+    float x[7] = {cx, cy, s, r, 0, 0, 0};
+    memcpy(x_, x, sizeof(x_));
+    memset(p_, 0, sizeof(p_));
+    for (int i = 0; i < 4; i++)
+        p_[i][i] = 10.f;
+    for (int i = 4; i < 7; i++)
+        p_[i][i] = 10000.f; // 速度未知
+}
+
+Bbox KalmanBox::predict()
+{
+    if (x_[2] + x_[6] <= 0)
+        x_[6] = 0;
+    // x = F x，F在单位阵的基础上cx、cy、s各加上对应速度
+    x_[0] += x_[4];
+    x_[1] += x_[5];
+    x_[2] += x_[6];
+
+    // P = F P F^T + Q：先行变换（row i += row i+4），再列变换（col j += col j+4）
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 7; j++)
+            p_[i][j] += p_[i + 4][j];
+    for (int i = 0; i < 7; i++)
+        for (int j = 0; j < 3; j++)
+            p_[i][j] += p_[i][j + 4];
+    for (int i = 0; i < 7; i++)
+        p_[i][i] += kProcessNoise[i];
+    return bbox();
+}
+
+// 4x4对称正定矩阵求逆（高斯-约当）
+static void invert4(const float a[4][4], float inv[4][4])
+{
+    float m[4][8];
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            m[i][j] = a[i][j];
+            m[i][j + 4] = i == j ? 1.f : 0.f;
+        }
+    }
+    for (int c = 0; c < 4; c++)
+    {
+        int pivot = c;
+        for (int r = c + 1; r < 4; r++)
+        {
+            if (std::fabs(m[r][c]) > std::fabs(m[pivot][c]))
+                pivot = r;
+        }
+        if (pivot != c)
+        {
+            for (int j = 0; j < 8; j++)
+                std::swap(m[c][j], m[pivot][j]);
+        }
+        float d = 1.f / m[c][c];
+        for (int j = 0; j < 8; j++)
+            m[c][j] *= d;
+        for (int r = 0; r < 4; r++)
+        {
+            if (r == c)
+                continue;
+            float f = m[r][c];
+            for (int j = 0; j < 8; j++)
+                m[r][j] -= f * m[c][j];
+        }
+    }
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            inv[i][j] = m[i][j + 4];
+}
+
+void KalmanBox::update(const Bbox &bbox)
+{
+    float z[4] = {bbox.x + bbox.w / 2, bbox.y + bbox.h / 2, bbox.w * bbox.h, bbox.h > 0 ? bbox.w / bbox.h : x_[3]};
+
+    // H只取状态的前4维，H P H^T为P的左上4x4，P H^T为P的前4列
+    float s[4][4], s_inv[4][4];
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            s[i][j] = p_[i][j] + (i == j ? kMeasureNoise[i] : 0.f);
+    invert4(s, s_inv);
+
+    // K = P H^T S^-1（7x4）
+    float k[7][4];
+    for (int i = 0; i < 7; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            float sum = 0;
+            for (int t = 0; t < 4; t++)
+                sum += p_[i][t] * s_inv[t][j];
+            k[i][j] = sum;
+        }
+    }
+
+    float y[4];
+    for (int i = 0; i < 4; i++)
+        y[i] = z[i] - x_[i];
+    for (int i = 0; i < 7; i++)
+        for (int j = 0; j < 4; j++)
+            x_[i] += k[i][j] * y[j];
+
+    // P = (I - K H) P = P - K * P[0:4, :]
+    float p[7][7];
+    memcpy(p, p_, sizeof(p));
+    for (int i = 0; i < 7; i++)
+    {
+        for (int j = 0; j < 7; j++)
+        {
+            float sum = 0;
+            for (int t = 0; t < 4; t++)
+                sum += k[i][t] * p[t][j];
+            p_[i][j] -= sum;
+        }
+    }
+}
+
+Bbox KalmanBox::bbox() const
+{
+    float s = std::max(x_[2], 0.f);
+    float r = std::max(x_[3], 1e-3f);
+    float w = std::sqrt(s * r);
+    float h = w > 0 ? s / w : 0;
+    return {x_[0] - w / 2, x_[1] - h / 2, w, h};
+}
+
+FaceTracker::FaceTracker(float iou_thresh, int max_age, int min_hits, int recognize_period, float score_drop)
+    : iou_thresh_(iou_thresh), max_age_(max_age), min_hits_(min_hits), recognize_period_(recognize_period), score_drop_(score_drop), next_id_(1)
+{
+}
+
+float FaceTracker::iou(const Bbox &a, const Bbox &b)
+{
+    float x1 = std::max(a.x, b.x);
+    float y1 = std::max(a.y, b.y);
+    float x2 = std::min(a.x + a.w, b.x + b.w);
+    float y2 = std::min(a.y + a.h, b.y + b.h);
+    if (x2 <= x1 || y2 <= y1)
+        return 0;
+    float inter = (x2 - x1) * (y2 - y1);
+    return inter / (a.w * a.h + b.w * b.h - inter);
+}
+
+std::vector<FaceTrack> &FaceTracker::update(const std::vector<FaceDetectionInfo> &dets)
+{
+    // 1. 所有轨迹预测到本帧
+    std::vector<Bbox> predicted;
+    predicted.reserve(tracks_.size());
+    for (auto &track : tracks_)
+    {
+        predicted.push_back(track.kf.predict());
+        track.age++;
+        track.time_since_update++;
+        track.frames_since_recognition++;
+    }
+
+    // 2. IoU贪心关联：人脸数很少，按IoU从大到小依次配对即可，不需要匈牙利算法
+    struct Pair
+    {
+        float iou;
+        int track;
+        int det;
+    };
+    std::vector<Pair> pairs;
+    for (int t = 0; t < (int)tracks_.size(); t++)
+    {
+        for (int d = 0; d < (int)dets.size(); d++)
+        {
+            float v = iou(predicted[t], dets[d].bbox);
+            if (v >= iou_thresh_)
+                pairs.push_back({v, t, d});
+        }
+    }
+    std::sort(pairs.begin(), pairs.end(), [](const Pair &a, const Pair &b) { return a.iou > b.iou; });
+    std::vector<bool> track_used(tracks_.size(), false), det_used(dets.size(), false);
+    for (auto &pair : pairs)
+    {
+        if (track_used[pair.track] || det_used[pair.det])
+            continue;
+        track_used[pair.track] = det_used[pair.det] = true;
+        FaceTrack &track = tracks_[pair.track];
+        track.kf.update(dets[pair.det].bbox);
+        track.det = dets[pair.det];
+        track.hits++;
+        track.time_since_update = 0;
+    }
+
+    // 3. 删除长时间未匹配的轨迹，未匹配的检测新建轨迹
+    tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(), [this](const FaceTrack &track) { return track.time_since_update > max_age_; }),
+                  tracks_.end());
+    for (int d = 0; d < (int)dets.size(); d++)
+    {
+        if (det_used[d])
+            continue;
+        FaceTrack track = {next_id_++, KalmanBox(dets[d].bbox), dets[d], 1, 1, 0, false, -1, 0.f, "", 0, 0.f};
+        tracks_.push_back(track);
+    }
+    return tracks_;
+}
+
+std::vector<FaceTrack> &FaceTracker::predict()
+{
+    for (auto &track : tracks_)
+    {
+        Bbox bbox = track.kf.predict();
+        float dx = bbox.x - track.det.bbox.x;
+        float dy = bbox.y - track.det.bbox.y;
+        for (int i = 0; i < 5; i++)
+        {
+            track.det.sparse_kps.points[2 * i] += dx;
+            track.det.sparse_kps.points[2 * i + 1] += dy;
+        }
+        track.det.bbox = bbox;
+        track.age++;
+        track.frames_since_recognition++;
+    }
+    return tracks_;
+}
+
+std::vector<FaceTrack> &FaceTracker::tracks()
+{
+    return tracks_;
+}
+
+bool FaceTracker::needs_recognition(const FaceTrack &track) const
+{
+    if (track.time_since_update != 0 || track.hits < min_hits_)
+        return false;
+    if (!track.identified)
+        return true;
+    if (recognize_period_ > 0 && track.frames_since_recognition >= recognize_period_)
+        return true;
+    return track.det.score < track.recognized_det_score - score_drop_;
+}
+
+void FaceTracker::set_identity(FaceTrack &track, int id, float score, const std::string &name)
+{
+    track.identified = true;
+    track.identity_id = id;
+    track.identity_score = score;
+    track.identity_name = name;
+    track.frames_since_recognition = 0;
+    track.recognized_det_score = track.det.score;
+}
+
+void FaceTracker::reset()
+{
+    tracks_.clear();
+}
@@ -0,0 +1,166 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _FACE_TRACKER_H
+#define _FACE_TRACKER_H
+
+#include <string>
+#include <vector>
+#include "face_detection.h"
+
+/**
+ * @brief 检测框的常速卡尔曼滤波（SORT）
+ * 状态为[cx, cy, s, r, vcx, vcy, vs]，s为面积、r为宽高比（假定不变），观测为[cx, cy, s, r]
+ */
+class KalmanBox
+{
+public:
+    /**
+     * @brief 用第一次检测到的框初始化，速度初始为0且方差很大
+     * @param bbox 检测框（左上角、宽高）
+     */
+    explicit KalmanBox(const Bbox &bbox);
+
+    /**
+     * @brief 预测下一帧的位置
+     * @return 预测框
+     */
+    Bbox predict();
+
+    /**
+     * @brief 用本帧匹配到的检测框校正
+     * @param bbox 检测框
+     * @return None
+     */
+    void update(const Bbox &bbox);
+
+    /**
+     * @brief 当前状态对应的框
+     * @return 框（左上角、宽高）
+     */
+    Bbox bbox() const;
+
+private:
+    float x_[7];     // 状态
+    float p_[7][7];  // 状态协方差
+};
+
+/**
+ * @brief 一条人脸轨迹及其缓存的识别结果
+ */
+typedef struct FaceTrack
+{
+    int id;                        // 轨迹ID，从1开始递增
+    KalmanBox kf;                  // 卡尔曼滤波器
+    FaceDetectionInfo det;         // 最近一次匹配到的检测结果（五官点用于识别）
+    int hits;                      // 匹配到检测的总帧数
+    int age;                       // 轨迹存在的总帧数
+    int time_since_update;         // 连续未匹配到检测的帧数，0表示本帧匹配到
+
+    bool identified;               // 是否已有识别结果
+    int identity_id;               // 识别结果对应ID
+    float identity_score;          // 识别结果对应得分
+    std::string identity_name;     // 识别结果对应人名
+    int frames_since_recognition;  // 距上次识别的帧数
+    float recognized_det_score;    // 上次识别时的检测置信度
+} FaceTrack;
+
+/**
+ * @brief 人脸跟踪（SORT：卡尔曼预测+IoU关联），每条轨迹缓存识别结果
+ * 只有新轨迹、检测置信度明显下降或距上次识别超过recognize_period帧时才需要重新识别，
+ * 人静止不动时识别kmodel和数据库查询不再每帧、每张人脸都跑
+ */
+class FaceTracker
+{
+public:
+    /**
+     * @brief FaceTracker构造函数
+     * @param iou_thresh        预测框与检测框IoU低于该值不关联
+     * @param max_age           连续max_age帧未匹配到检测的轨迹被删除
+     * @param min_hits          匹配到min_hits次之后才做识别，过滤单帧误检
+     * @param recognize_period  距上次识别超过该帧数重新识别，<=0表示不按周期重识别
+     * @param score_drop        检测置信度比上次识别时下降超过该值时重新识别（遮挡、侧脸等）
+     * @return None
+     */
+    FaceTracker(float iou_thresh = 0.3f, int max_age = 5, int min_hits = 1, int recognize_period = 30, float score_drop = 0.15f);
+
+    /**
+     * @brief 输入一帧的检测结果，更新所有轨迹
+     * @param dets  FaceDetection::post_process的结果
+     * @return 所有存活的轨迹，time_since_update为0的是本帧匹配到检测的
+     */
+    std::vector<FaceTrack> &update(const std::vector<FaceDetectionInfo> &dets);
+
+    /**
+     * @brief 跳过检测的帧（MotionGate判断画面无变化）只做卡尔曼预测，检测框和五官点随预测平移
+     * 不算作未匹配，当前可见的轨迹保持可见，缓存的识别结果继续沿用
+     * @return 所有存活的轨迹
+     */
+    std::vector<FaceTrack> &predict();
+
+    /**
+     * @brief 所有存活的轨迹
+     * @return 轨迹列表
+     */
+    std::vector<FaceTrack> &tracks();
+
+    /**
+     * @brief 本帧是否需要对该轨迹跑识别
+     * @param track 轨迹
+     * @return 需要返回true
+     */
+    bool needs_recognition(const FaceTrack &track) const;
+
+    /**
+     * @brief 记录轨迹的识别结果
+     * @param track  轨迹
+     * @param id     识别结果对应ID
+     * @param score  识别结果对应得分
+     * @param name   识别结果对应人名
+     * @return None
+     */
+    void set_identity(FaceTrack &track, int id, float score, const std::string &name);
+
+    /**
+     * @brief 清空所有轨迹（如人脸数据库重置后，缓存的识别结果失效）
+     * @return None
+     */
+    void reset();
+
+    /**
+     * @brief 两个框（左上角、宽高）的IoU
+     */
+    static float iou(const Bbox &a, const Bbox &b);
+
+private:
+    float iou_thresh_;
+    int max_age_;
+    int min_hits_;
+    int recognize_period_;
+    float score_drop_;
+    int next_id_;
+    std::vector<FaceTrack> tracks_;
+};
+
+#endif
@@ -0,0 +1,79 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _FAST_EXP_HPP
+#define _FAST_EXP_HPP
+
+#include <cstdint>
+#include <cstring>
+
+// fast_exp在[-87, 88]内的最大相对误差（6阶多项式截断误差约1.2e-7，加上float舍入）
+#define FAST_EXP_MAX_REL_ERROR (5e-7f)
+
+/**
+ * @brief 快速exp（float）
+ * exp(x) = 2^n * exp(r)，n = round(x / ln2)，r = x - n * ln2 ∈ [-ln2/2, ln2/2]（ln2拆成高低两部分减少舍入误差），
+ * exp(r)用6阶泰勒多项式计算，2^n直接拼出float的指数位；x截断到[-87, 88]，结果不会溢出或变成非规格化数。
+ * 只有乘加、整数比较和位运算，没有分支和函数调用，对数组循环调用时编译器可以向量化
+ * @param x  输入
+ * @return exp(x)的近似值，相对误差不超过FAST_EXP_MAX_REL_ERROR
+ */
+static inline float fast_exp(float x)
+{
+    // 在位模式上截断：同号的float按位模式比较与按数值比较顺序一致（负数反序），只用整数比较，
+    // 不出现浮点比较（默认的-ftrapping-math下浮点比较会阻止向量化），nan、inf也被截断
+    int32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int32_t limit = bits < 0 ? (int32_t)0xc2ae0000 : 0x42b00000; // -87.f、88.f
+    bits = bits > limit ? limit : bits;
+    memcpy(&x, &bits, sizeof(x));
+    float t = x * 1.44269504088896341f;
+    // 加减1.5*2^23按当前舍入方式（就近）取整，不需要floor/round
+    float fn = (t + 12582912.f) - 12582912.f;
+    float r = x - fn * 0.693145751953125f - fn * 1.42860682030941723e-6f;
+    float p = 1.f + r * (1.f + r * (0.5f + r * (1.f / 6 + r * (1.f / 24 + r * (1.f / 120 + r * (1.f / 720))))));
+    bits = ((int32_t)fn + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+/**
+ * @brief 对数组逐个计算fast_exp
+ * @param x  输入数组
+ * @param y  输出数组，与x相同或不重叠
+ * @param n  个数
+ * @return None
+ */
+static inline void fast_exp(const float *x, float *y, int n)
+{
+    // 各元素独立，用omp simd说明可以向量化（-O2的代价模型不做别名检查的循环版本化）
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+    for (int i = 0; i < n; i++)
+        y[i] = fast_exp(x[i]);
+}
+
+#endif
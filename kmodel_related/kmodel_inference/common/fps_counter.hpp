@@ -0,0 +1,86 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _FPS_COUNTER_HPP
+#define _FPS_COUNTER_HPP
+
+#include <chrono>
+#include <string>
+#include <iostream>
+
+/**
+ * @brief 帧率统计类
+ * 每帧调用tick，每隔一秒统计一次这段时间内的平均帧率（enable_profile时打印）
+ */
+class FpsCounter
+{
+public:
+    /**
+     * @brief FpsCounter构造函数
+     * @param info           统计对象名称
+     * @param enable_profile 是否打印帧率
+     * @return None
+     */
+    FpsCounter(std::string info, int enable_profile = 1)
+        : m_info(info), enable_profile(enable_profile), m_frames(0), m_fps(0), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /**
+     * @brief 记录一帧，满一秒时更新（并打印）帧率
+     * @return true（本次更新了帧率），false（未满一秒）
+     */
+    bool tick()
+    {
+        ++m_frames;
+        auto now = std::chrono::steady_clock::now();
+        double elapsed_s = std::chrono::duration<double>(now - m_start).count();
+        if (elapsed_s < 1.0)
+            return false;
+        m_fps = m_frames / elapsed_s;
+        if (enable_profile)
+            std::cout << m_info << " fps: " << m_fps << std::endl;
+        m_frames = 0;
+        m_start = now;
+        return true;
+    }
+
+    /**
+     * @brief 最近一个统计周期的帧率
+     * @return 帧率
+     */
+    double fps() const
+    {
+        return m_fps;
+    }
+
+private:
+    std::string m_info;                            // 统计对象名称
+    int enable_profile;                            // 是否打印帧率
+    int m_frames;                                  // 本统计周期内的帧数
+    double m_fps;                                  // 最近一个统计周期的帧率
+    std::chrono::steady_clock::time_point m_start; // 本统计周期开始时间
+};
+
+#endif
@@ -0,0 +1,297 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "frame_source.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <strings.h>
+#include <unistd.h>
+#if K230_VIDEO_FILE_SOURCE
+#include "video_file_source.h"
+#endif
+
+FrameSource::FrameSource(int width, int height, FrameFormat format)
+    : width_(width), height_(height), format_(format)
+{
+}
+
+FrameSource::~FrameSource()
+{
+}
+
+int FrameSource::width() const
+{
+    return width_;
+}
+
+int FrameSource::height() const
+{
+    return height_;
+}
+
+FrameFormat FrameSource::format() const
+{
+    return format_;
+}
+
+size_t FrameSource::frame_size() const
+{
+    return frame_size(width_, height_, format_);
+}
+
+size_t FrameSource::frame_size(int width, int height, FrameFormat format)
+{
+    if (format == FRAME_NV12)
+        return (size_t)width * height * 3 / 2;
+    return (size_t)width * height * 3;
+}
+
+uint64_t FrameSource::now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool FrameSource::read(uint8_t *dst, FrameInfo &info, int timeout_ms)
+{
+    return grab(info, timeout_ms) && retrieve(dst);
+}
+
+SyntheticFrameSource::SyntheticFrameSource(int width, int height, FrameFormat format, int seed, float fps, int queue_depth)
+    : FrameSource(width, height, format), seed_(seed), period_us_(fps > 0 ? (uint64_t)(1e6f / fps) : 0),
+      queue_depth_(queue_depth > 0 ? queue_depth : 1), start_us_(0), next_(0), held_(0), holding_(false)
+{
+}
+
+bool SyntheticFrameSource::grab(FrameInfo &info, int timeout_ms)
+{
+    uint64_t now = now_us();
+    uint64_t timestamp = now;
+    // 不限速时帧按需产生，不存在排队的旧帧，丢帧策略的非阻塞grab直接返回
+    if (!period_us_ && timeout_ms == 0)
+        return false;
+    if (period_us_)
+    {
+        if (start_us_ == 0)
+            start_us_ = now;
+        // 已产生的最新一帧之前超出缓存深度的帧已被覆盖
+        unsigned long latest = (now - start_us_) / period_us_;
+        if (latest + 1 > next_ + queue_depth_)
+            next_ = latest + 1 - queue_depth_;
+        uint64_t ready = start_us_ + next_ * period_us_;
+        if (ready > now)
+        {
+            if (ready - now > (uint64_t)timeout_ms * 1000)
+                return false;
+            std::this_thread::sleep_for(std::chrono::microseconds(ready - now));
+        }
+        timestamp = ready;
+    }
+
+    held_ = next_++;
+    holding_ = true;
+    info.frame_id = held_ + 1;
+    info.timestamp_us = timestamp;
+    return true;
+}
+
+bool SyntheticFrameSource::retrieve(uint8_t *dst)
+{
+    if (!holding_)
+        return false;
+    holding_ = false;
+
+    // 方块边长为帧高的1/4，沿x方向来回移动，每路流的起点和速度不同
+    int side = height_ / 4;
+    int range = width_ - side;
+    int step = 4 + 3 * (seed_ % 5);
+    int pos = (int)((held_ * step + (unsigned long)seed_ * 97) % (unsigned long)(2 * range));
+    int sx = pos < range ? pos : 2 * range - pos;
+    int sy = (height_ - side) / 2;
+
+    size_t plane = (size_t)width_ * height_;
+    for (int r = 0; r < height_; r++)
+    {
+        uint8_t *row = dst + (size_t)r * width_;
+        bool in_rows = r >= sy && r < sy + side;
+        for (int c = 0; c < width_; c++)
+            row[c] = (in_rows && c >= sx && c < sx + side) ? 230 : (uint8_t)(60 + ((r / 40 + c / 40) % 2) * 80);
+    }
+    // rgb planar三个通道相同（灰度），nv12的uv为128（无色度）
+    if (format_ == FRAME_NV12)
+    {
+        memset(dst + plane, 128, plane / 2);
+    }
+    else
+    {
+        memcpy(dst + plane, dst, plane);
+        memcpy(dst + 2 * plane, dst, plane);
+    }
+    return true;
+}
+
+void SyntheticFrameSource::discard()
+{
+    holding_ = false;
+}
+
+const char *SyntheticFrameSource::name() const
+{
+    return "synthetic";
+}
+
+ReplayClock::ReplayClock(float fps) : period_us_(fps > 0 ? (uint64_t)(1e6f / fps) : 0), start_us_(0)
+{
+}
+
+bool ReplayClock::wait(unsigned long index, int timeout_ms, uint64_t &timestamp)
+{
+    uint64_t now = FrameSource::now_us();
+    if (!period_us_)
+    {
+        timestamp = now;
+        return timeout_ms != 0;
+    }
+    if (start_us_ == 0)
+        start_us_ = now - index * period_us_;
+    uint64_t due = start_us_ + index * period_us_;
+    if (due > now)
+    {
+        if (due - now > (uint64_t)timeout_ms * 1000)
+            return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(due - now));
+    }
+    timestamp = due;
+    return true;
+}
+
+static std::string format_index(const std::string &pattern, int index)
+{
+    char name[1024];
+    snprintf(name, sizeof(name), pattern.c_str(), index);
+    return name;
+}
+
+FileSequenceSource::FileSequenceSource(const std::string &path, int width, int height, FrameFormat format, float fps, int loop)
+    : FrameSource(width, height, format), path_(path), pattern_(path.find('%') != std::string::npos), first_index_(0),
+      frames_(0), loop_(loop), clock_(fps), next_(0), held_(0), holding_(false)
+{
+    if (pattern_)
+    {
+        // 编号从0或1开始，连续的文件为一遍回放
+        if (access(format_index(path_, 0).c_str(), R_OK) != 0)
+            first_index_ = 1;
+        while (access(format_index(path_, first_index_ + (int)frames_).c_str(), R_OK) == 0)
+            frames_++;
+    }
+    else if (file_.open(path_.c_str()))
+    {
+        if (file_.size() % frame_size() != 0)
+            std::cerr << path_ << ": size " << file_.size() << " is not a multiple of frame size " << frame_size() << ", trailing bytes ignored" << std::endl;
+        frames_ = file_.size() / frame_size();
+    }
+    if (!frames_)
+        std::cerr << path_ << ": no frames" << std::endl;
+}
+
+bool FileSequenceSource::grab(FrameInfo &info, int timeout_ms)
+{
+    if (!frames_ || (loop_ > 0 && next_ >= frames_ * loop_))
+        return false;
+    uint64_t timestamp;
+    if (!clock_.wait(next_, timeout_ms, timestamp))
+        return false;
+    held_ = next_++;
+    holding_ = true;
+    info.frame_id = held_ + 1;
+    info.timestamp_us = timestamp;
+    return true;
+}
+
+bool FileSequenceSource::retrieve(uint8_t *dst)
+{
+    if (!holding_)
+        return false;
+    holding_ = false;
+    size_t index = held_ % frames_;
+    if (pattern_)
+        return BinaryIO::read_exact(format_index(path_, first_index_ + (int)index).c_str(), dst, frame_size());
+    memcpy(dst, file_.data() + index * frame_size(), frame_size());
+    return true;
+}
+
+void FileSequenceSource::discard()
+{
+    holding_ = false;
+}
+
+const char *FileSequenceSource::name() const
+{
+    return "file";
+}
+
+size_t FileSequenceSource::frames() const
+{
+    return frames_;
+}
+
+static bool has_suffix(const std::string &s, const char *suffix)
+{
+    size_t n = strlen(suffix);
+    return s.size() >= n && strcasecmp(s.c_str() + s.size() - n, suffix) == 0;
+}
+
+std::unique_ptr<FrameSource> open_frame_source(const std::string &spec, int width, int height, FrameFormat format, float fps, int loop)
+{
+    if (spec.compare(0, 9, "synthetic") == 0)
+    {
+        int seed = spec.size() > 10 && spec[9] == ':' ? atoi(spec.c_str() + 10) : 0;
+        return std::unique_ptr<FrameSource>(new SyntheticFrameSource(width, height, format, seed, fps));
+    }
+
+    static const char *video_suffixes[] = {".mp4", ".avi", ".mkv", ".mov", ".h264", ".h265"};
+    for (const char *suffix : video_suffixes)
+    {
+        if (!has_suffix(spec, suffix))
+            continue;
+#if K230_VIDEO_FILE_SOURCE
+        std::unique_ptr<VideoFileSource> video(new VideoFileSource(spec, width, height, format, fps, loop));
+        if (!video->is_open())
+            return nullptr;
+        return std::unique_ptr<FrameSource>(video.release());
+#else
+        std::cerr << spec << ": video files need opencv videoio (host build)" << std::endl;
+        return nullptr;
+#endif
+    }
+
+    std::unique_ptr<FileSequenceSource> file(new FileSequenceSource(spec, width, height, format, fps, loop));
+    if (!file->frames())
+        return nullptr;
+    return std::unique_ptr<FrameSource>(file.release());
+}
@@ -0,0 +1,267 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _FRAME_SOURCE_H
+#define _FRAME_SOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "binary_io.h"
+
+/**
+ * @brief 帧数据格式
+ */
+enum FrameFormat
+{
+    FRAME_RGB_PLANAR, // rgb888 planar（chw）
+    FRAME_NV12,       // y平面 + uv交织平面
+};
+
+/**
+ * @brief 一帧的元信息
+ */
+typedef struct FrameInfo
+{
+    unsigned long frame_id; // 帧序号，从1开始，每个源独立计数
+    uint64_t timestamp_us;  // 采集时间（steady_clock，微秒）
+} FrameInfo;
+
+/**
+ * @brief 帧数据源接口
+ * grab取得下一帧（不拷贝），retrieve把它拷贝到调用者的isp内存，discard直接归还；丢帧策略可以只grab不拷贝地跳过过时的帧。
+ * vicap、合成帧等实现共用这一接口，使推理流水线不依赖具体的采集方式
+ */
+class FrameSource
+{
+public:
+    /**
+     * @brief FrameSource构造函数
+     * @param width   帧宽
+     * @param height  帧高
+     * @param format  帧数据格式
+     * @return None
+     */
+    FrameSource(int width, int height, FrameFormat format);
+
+    virtual ~FrameSource();
+
+    /**
+     * @brief 取得下一帧，不拷贝数据；成功时之前grab但未retrieve的帧被归还（丢弃），
+     *        失败时之前grab的帧仍被持有，可以retrieve（丢帧策略靠非阻塞grab失败判断已取到最新帧）
+     * @param info        返回该帧的序号和时间戳，失败时不变
+     * @param timeout_ms  最多等待的时间，0表示没有就绪的帧时立即返回
+     * @return 成功返回true；超时、读取失败或已到结尾返回false
+     */
+    virtual bool grab(FrameInfo &info, int timeout_ms) = 0;
+
+    /**
+     * @brief 把最近grab的帧拷贝到目标内存并归还
+     * @param dst  目标内存，至少frame_size()字节
+     * @return 成功返回true
+     */
+    virtual bool retrieve(uint8_t *dst) = 0;
+
+    /**
+     * @brief 归还最近grab的帧，不拷贝
+     * @return None
+     */
+    virtual void discard() = 0;
+
+    /**
+     * @brief 读取下一帧（grab + retrieve）
+     * @param dst         目标内存，至少frame_size()字节
+     * @param info        返回该帧的序号和时间戳
+     * @param timeout_ms  最多等待的时间
+     * @return 成功返回true
+     */
+    bool read(uint8_t *dst, FrameInfo &info, int timeout_ms = 1000);
+
+    /**
+     * @brief 数据源名称，用于日志
+     * @return 名称
+     */
+    virtual const char *name() const = 0;
+
+    int width() const;
+    int height() const;
+    FrameFormat format() const;
+
+    /**
+     * @brief 一帧的字节数
+     * @return rgb planar为3*w*h，nv12为w*h*3/2
+     */
+    size_t frame_size() const;
+
+    /**
+     * @brief 按格式计算一帧的字节数
+     * @param width   帧宽
+     * @param height  帧高
+     * @param format  帧数据格式
+     * @return 字节数
+     */
+    static size_t frame_size(int width, int height, FrameFormat format);
+
+    /**
+     * @brief 当前时间（steady_clock，微秒），各实现用来给帧打时间戳
+     * @return 微秒
+     */
+    static uint64_t now_us();
+
+protected:
+    int width_;          // 帧宽
+    int height_;         // 帧高
+    FrameFormat format_; // 帧数据格式
+};
+
+/**
+ * @brief 合成帧数据源
+ * 固定纹理背景上有一个来回移动的亮方块，用于在没有sensor的主机上测试多路流水线。
+ * 限速时模拟实时摄像头：第k帧在第一次grab后k个帧间隔时产生，时间戳为产生时刻；
+ * 最多缓存queue_depth帧，读得慢时更早的帧被覆盖，与vicap的dump队列行为一致
+ */
+class SyntheticFrameSource : public FrameSource
+{
+public:
+    /**
+     * @brief SyntheticFrameSource构造函数
+     * @param width        帧宽
+     * @param height       帧高
+     * @param format       帧数据格式
+     * @param seed         不同的值使方块的起点和速度不同，区分多路合成流
+     * @param fps          摄像头帧率，<=0表示不限速（阻塞的grab立即产生新的一帧，非阻塞的grab没有帧）
+     * @param queue_depth  限速时缓存的帧数
+     * @return None
+     */
+    SyntheticFrameSource(int width, int height, FrameFormat format, int seed = 0, float fps = 0.f, int queue_depth = 3);
+
+    bool grab(FrameInfo &info, int timeout_ms) override;
+
+    bool retrieve(uint8_t *dst) override;
+
+    void discard() override;
+
+    const char *name() const override;
+
+private:
+    int seed_;                  // 方块运动参数
+    uint64_t period_us_;        // 帧间隔，0表示不限速
+    int queue_depth_;           // 缓存的帧数
+    uint64_t start_us_;         // 第0帧的产生时间，第一次grab时确定
+    unsigned long next_;        // 下一个未读帧的序号（从0开始）
+    unsigned long held_;        // grab取得的帧序号
+    bool holding_;              // 是否持有grab取得的帧
+};
+
+/**
+ * @brief 文件回放的出帧节奏
+ * fps>0时按固定帧率出帧，第k帧的时间戳为第一帧时间+k个间隔，与读取、推理的实际耗时无关，多次回放结果可重复；
+ * fps<=0时尽快出帧（按需读取），时间戳为读取时刻
+ */
+class ReplayClock
+{
+public:
+    /**
+     * @brief ReplayClock构造函数
+     * @param fps 回放帧率，<=0表示尽快出帧
+     * @return None
+     */
+    explicit ReplayClock(float fps = 0.f);
+
+    /**
+     * @brief 等到第index帧的出帧时间
+     * @param index       帧序号（从0开始，循环回放时继续累加）
+     * @param timeout_ms  最多等待的时间；尽快出帧时timeout为0返回false（没有排队的帧）
+     * @param timestamp   返回该帧的时间戳
+     * @return 到了出帧时间返回true
+     */
+    bool wait(unsigned long index, int timeout_ms, uint64_t &timestamp);
+
+private:
+    uint64_t period_us_;    // 帧间隔，0表示尽快出帧
+    uint64_t start_us_;     // 第0帧的出帧时间，第一次wait时确定
+};
+
+/**
+ * @brief 原始帧文件数据源
+ * path含printf格式（如frames/%04d.bin，从0或1开始编号）时每个文件一帧，否则为一个文件中首尾相接的多帧；
+ * 每帧为frame_size()字节的rgb888 planar或nv12数据（如vicap dump、test_preprocess保存的数据）
+ */
+class FileSequenceSource : public FrameSource
+{
+public:
+    /**
+     * @brief FileSequenceSource构造函数
+     * @param path    文件路径或逐帧文件的printf格式
+     * @param width   帧宽
+     * @param height  帧高
+     * @param format  帧数据格式
+     * @param fps     回放帧率，<=0表示尽快出帧
+     * @param loop    回放遍数，0表示无限循环
+     * @return None
+     */
+    FileSequenceSource(const std::string &path, int width, int height, FrameFormat format, float fps = 0.f, int loop = 1);
+
+    bool grab(FrameInfo &info, int timeout_ms) override;
+
+    bool retrieve(uint8_t *dst) override;
+
+    void discard() override;
+
+    const char *name() const override;
+
+    /**
+     * @brief 一遍回放的帧数，打开失败时为0
+     * @return 帧数
+     */
+    size_t frames() const;
+
+private:
+    std::string path_;          // 文件路径或printf格式
+    bool pattern_;              // 是否为逐帧文件
+    int first_index_;           // 逐帧文件的起始编号
+    MappedFile file_;           // 多帧文件的映射
+    size_t frames_;             // 一遍回放的帧数
+    int loop_;                  // 回放遍数，0表示无限循环
+    ReplayClock clock_;         // 出帧节奏
+    unsigned long next_;        // 下一帧的序号（循环回放时累加）
+    unsigned long held_;        // grab取得的帧序号
+    bool holding_;              // 是否持有grab取得的帧
+};
+
+/**
+ * @brief 按描述打开数据源
+ * @param spec    synthetic[:seed]（合成帧）、.mp4/.avi/.mkv/.mov/.h264/.h265视频文件（需opencv videoio，主机编译）、
+ *                其它为原始帧文件（FileSequenceSource）
+ * @param width   帧宽
+ * @param height  帧高
+ * @param format  帧数据格式
+ * @param fps     回放帧率，<=0表示尽快出帧
+ * @param loop    回放遍数，0表示无限循环（合成帧不结束）
+ * @return 数据源，打开失败返回空
+ */
+std::unique_ptr<FrameSource> open_frame_source(const std::string &spec, int width, int height, FrameFormat format, float fps = 0.f, int loop = 1);
+
+#endif
@@ -0,0 +1,166 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "latency_policy.h"
+
+#include <cstdlib>
+#include <iostream>
+
+LatencyPolicy::LatencyPolicy(LatencyMode mode, int every_n, float target_fps)
+    : mode_(mode), every_n_(every_n > 0 ? every_n : 1), period_us_(target_fps > 0 ? (uint64_t)(1e6f / target_fps) : 0),
+      next_due_us_(0), seen_(0), last_dropped_(0), processed_(0), dropped_(0)
+{
+    if (mode_ == LATENCY_TARGET_FPS && !period_us_)
+        mode_ = LATENCY_NEWEST;
+}
+
+bool LatencyPolicy::parse(const std::string &text, LatencyPolicy &policy)
+{
+    if (text == "all")
+    {
+        policy = LatencyPolicy(LATENCY_ALL);
+        return true;
+    }
+    if (text == "newest")
+    {
+        policy = LatencyPolicy(LATENCY_NEWEST);
+        return true;
+    }
+    if (text.compare(0, 6, "every:") == 0)
+    {
+        int n = atoi(text.c_str() + 6);
+        if (n < 1)
+            return false;
+        policy = LatencyPolicy(LATENCY_EVERY_NTH, n);
+        return true;
+    }
+    if (text.compare(0, 4, "fps:") == 0)
+    {
+        float fps = atof(text.c_str() + 4);
+        if (fps <= 0)
+            return false;
+        policy = LatencyPolicy(LATENCY_TARGET_FPS, 1, fps);
+        return true;
+    }
+    return false;
+}
+
+LatencyPolicy LatencyPolicy::from_env()
+{
+    LatencyPolicy policy;
+    const char *env = getenv("K230_FRAME_POLICY");
+    if (env && !parse(env, policy))
+    {
+        std::cerr << "K230_FRAME_POLICY=" << env << " not recognized (all, newest, every:N, fps:F), using newest" << std::endl;
+        policy = LatencyPolicy();
+    }
+    return policy;
+}
+
+bool LatencyPolicy::next(FrameSource &source, uint8_t *dst, FrameInfo &info, int timeout_ms)
+{
+    last_dropped_ = 0;
+    for (;;)
+    {
+        if (!source.grab(info, timeout_ms))
+            return false;
+
+        // 取走排队的帧直到没有就绪的帧，每次grab都归还上一帧，只留下最新的一帧
+        if (mode_ == LATENCY_NEWEST || mode_ == LATENCY_TARGET_FPS)
+        {
+            FrameInfo newer;
+            while (source.grab(newer, 0))
+            {
+                info = newer;
+                last_dropped_++;
+                dropped_++;
+            }
+        }
+
+        bool take = true;
+        if (mode_ == LATENCY_EVERY_NTH)
+        {
+            take = seen_++ % every_n_ == 0;
+        }
+        else if (mode_ == LATENCY_TARGET_FPS)
+        {
+            // 容许提前1/4个间隔，避免摄像头帧间隔的抖动使本该处理的帧被推迟一整个摄像头周期
+            take = info.timestamp_us + period_us_ / 4 >= next_due_us_;
+            if (take)
+            {
+                // 落后超过一个间隔时从当前帧重新计时，不连续补帧
+                if (next_due_us_ && info.timestamp_us < next_due_us_ + period_us_)
+                    next_due_us_ += period_us_;
+                else
+                    next_due_us_ = info.timestamp_us + period_us_;
+            }
+        }
+
+        if (take)
+        {
+            if (!source.retrieve(dst))
+                return false;
+            processed_++;
+            return true;
+        }
+        source.discard();
+        last_dropped_++;
+        dropped_++;
+    }
+}
+
+int LatencyPolicy::last_dropped() const
+{
+    return last_dropped_;
+}
+
+uint64_t LatencyPolicy::processed() const
+{
+    return processed_;
+}
+
+uint64_t LatencyPolicy::dropped() const
+{
+    return dropped_;
+}
+
+LatencyMode LatencyPolicy::mode() const
+{
+    return mode_;
+}
+
+std::string LatencyPolicy::describe() const
+{
+    switch (mode_)
+    {
+    case LATENCY_ALL:
+        return "all";
+    case LATENCY_EVERY_NTH:
+        return "every:" + std::to_string(every_n_);
+    case LATENCY_TARGET_FPS:
+        return "fps:" + std::to_string(1e6 / period_us_);
+    default:
+        return "newest";
+    }
+}
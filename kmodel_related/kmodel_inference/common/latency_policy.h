@@ -0,0 +1,111 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _LATENCY_POLICY_H
+#define _LATENCY_POLICY_H
+
+#include <cstdint>
+#include <string>
+#include "frame_source.h"
+
+/**
+ * @brief 采集循环的丢帧策略
+ */
+enum LatencyMode
+{
+    LATENCY_ALL,        // 按顺序处理每一帧，推理跟不上时排队延迟增长到数据源的缓存深度
+    LATENCY_NEWEST,     // 每次只处理最新的一帧，排队中的旧帧直接归还（默认）
+    LATENCY_EVERY_NTH,  // 每N帧处理一帧
+    LATENCY_TARGET_FPS, // 只处理最新的帧，并把处理帧率限制在目标帧率
+};
+
+/**
+ * @brief 按丢帧策略从数据源取下一帧要处理的帧
+ * 被丢弃的帧只grab不拷贝；推理比采集慢时newest/target fps使每帧结果对应的画面最多晚一个推理周期，
+ * 以处理更少的帧换取更低的延迟
+ */
+class LatencyPolicy
+{
+public:
+    /**
+     * @brief LatencyPolicy构造函数
+     * @param mode        丢帧策略
+     * @param every_n     LATENCY_EVERY_NTH时的N
+     * @param target_fps  LATENCY_TARGET_FPS时的目标帧率
+     * @return None
+     */
+    LatencyPolicy(LatencyMode mode = LATENCY_NEWEST, int every_n = 1, float target_fps = 0.f);
+
+    /**
+     * @brief 解析策略字符串：all、newest、every:N、fps:F
+     * @param text    策略字符串
+     * @param policy  解析结果
+     * @return 格式正确返回true
+     */
+    static bool parse(const std::string &text, LatencyPolicy &policy);
+
+    /**
+     * @brief 按环境变量K230_FRAME_POLICY创建策略，未设置或格式错误时为newest
+     * @return 策略
+     */
+    static LatencyPolicy from_env();
+
+    /**
+     * @brief 取下一帧要处理的帧，拷贝到dst
+     * @param source      数据源
+     * @param dst         目标内存
+     * @param info        返回该帧的序号和时间戳
+     * @param timeout_ms  等待新帧的超时时间
+     * @return 成功返回true，数据源超时或失败返回false
+     */
+    bool next(FrameSource &source, uint8_t *dst, FrameInfo &info, int timeout_ms = 1000);
+
+    /**
+     * @brief 最近一次next丢弃的帧数
+     * @return 帧数
+     */
+    int last_dropped() const;
+
+    uint64_t processed() const;
+    uint64_t dropped() const;
+    LatencyMode mode() const;
+
+    /**
+     * @brief 策略的文字描述，如every:3
+     * @return 描述
+     */
+    std::string describe() const;
+
+private:
+    LatencyMode mode_;      // 丢帧策略
+    int every_n_;           // 每N帧处理一帧
+    uint64_t period_us_;    // 目标帧率对应的处理间隔
+    uint64_t next_due_us_;  // 下一帧最早的处理时间（按帧时间戳）
+    uint64_t seen_;         // every_n计数
+    int last_dropped_;      // 最近一次next丢弃的帧数
+    uint64_t processed_;    // 处理的帧数
+    uint64_t dropped_;      // 丢弃的帧数
+};
+
+#endif
@@ -0,0 +1,104 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _LATEST_MAILBOX_HPP
+#define _LATEST_MAILBOX_HPP
+
+#include <atomic>
+
+/**
+ * @brief 单生产者、单消费者的最新结果邮箱（三缓冲，无锁）
+ * 生产者（推理线程）在write_slot中写好结果后publish；消费者（osd线程）调用update取最新结果，
+ * 中间未被取走的结果直接被覆盖，双方都不会等待对方
+ */
+template <class T>
+class LatestMailbox
+{
+public:
+    LatestMailbox() : state_(1), write_(0), read_(2), tags_{0, 0, 0}
+    {
+    }
+
+    /**
+     * @brief 生产者当前可写的槽，保留上次使用时的内容（vector等容量可复用）
+     * @return 可写的槽
+     */
+    T &write_slot()
+    {
+        return slots_[write_];
+    }
+
+    /**
+     * @brief 发布write_slot中的结果，并换一个新的可写槽
+     * @param tag 随结果一起发布的标记（如帧号），消费者通过read_tag取得
+     * @return None
+     */
+    void publish(unsigned long tag = 0)
+    {
+        tags_[write_] = tag;
+        write_ = state_.exchange(write_ | kNewFlag, std::memory_order_acq_rel) & kIndexMask;
+    }
+
+    /**
+     * @brief 消费者获取最新结果
+     * @return true（有新结果，read_slot已更新），false（没有新结果，read_slot不变）
+     */
+    bool update()
+    {
+        if (!(state_.load(std::memory_order_acquire) & kNewFlag))
+            return false;
+        read_ = state_.exchange(read_, std::memory_order_acq_rel) & kIndexMask;
+        return true;
+    }
+
+    /**
+     * @brief 消费者当前持有的结果
+     * @return 最近一次update取到的结果
+     */
+    T &read_slot()
+    {
+        return slots_[read_];
+    }
+
+    /**
+     * @brief 消费者当前持有结果的标记
+     * @return read_slot发布时传入的tag
+     */
+    unsigned long read_tag() const
+    {
+        return tags_[read_];
+    }
+
+private:
+    static const int kIndexMask = 0x3;
+    static const int kNewFlag = 0x4;
+
+    T slots_[3];                // 三个槽：生产者写、中转、消费者读各占一个
+    std::atomic<int> state_;    // 中转槽序号 | 是否为未读的新结果
+    int write_;                 // 生产者持有的槽（只由生产者访问）
+    int read_;                  // 消费者持有的槽（只由消费者访问）
+    unsigned long tags_[3];     // 各槽结果的标记，随槽一起在两个线程间交接
+};
+
+#endif
@@ -0,0 +1,227 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "mem_accounting.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <set>
+
+// line中key之后的数值（支持0x十六进制），找不到返回false
+static bool parse_number(const std::string &line, const char *key, uint64_t &value, size_t *end_pos = nullptr)
+{
+    size_t pos = line.find(key);
+    if (pos == std::string::npos)
+        return false;
+    const char *start = line.c_str() + pos + strlen(key);
+    while (*start == ' ')
+        start++;
+    char *end = nullptr;
+    value = strtoull(start, &end, 0);
+    if (end == start)
+        return false;
+    if (end_pos)
+        *end_pos = end - line.c_str();
+    return true;
+}
+
+// 带单位的大小，如4KB、128MB、4096
+static bool parse_size(const std::string &line, const char *key, uint64_t &bytes)
+{
+    size_t end = 0;
+    if (!parse_number(line, key, bytes, &end))
+        return false;
+    if (line.compare(end, 2, "KB") == 0)
+        bytes *= 1024;
+    else if (line.compare(end, 2, "MB") == 0)
+        bytes *= 1024 * 1024;
+    return true;
+}
+
+// key后面双引号中的字符串
+static std::string parse_quoted(const std::string &line, const char *key)
+{
+    size_t pos = line.find(key);
+    if (pos == std::string::npos)
+        return "";
+    pos = line.find('"', pos + strlen(key));
+    if (pos == std::string::npos)
+        return "";
+    size_t end = line.find('"', pos + 1);
+    return line.substr(pos + 1, end == std::string::npos ? std::string::npos : end - pos - 1);
+}
+
+// phys(0x..., 0x...)或PHYS(0x..., 0x...)
+static bool parse_phys(const std::string &line, const char *key, uint64_t &start, uint64_t &end)
+{
+    size_t comma = 0;
+    if (!parse_number(line, key, start, &comma))
+        return false;
+    if (comma >= line.size() || line[comma] != ',')
+        return false;
+    end = strtoull(line.c_str() + comma + 1, nullptr, 0);
+    return true;
+}
+
+bool MemAccounting::parse_media_mem(std::istream &in, MemSnapshot &snapshot)
+{
+    snapshot.mmz_valid = false;
+    snapshot.mmz_total_bytes = 0;
+    snapshot.mmz_used_bytes = 0;
+    snapshot.mmbs.clear();
+
+    uint64_t zones_bytes = 0;
+    uint64_t summary_total = 0;
+    std::string zone;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.find("ZONE:") != std::string::npos)
+        {
+            uint64_t bytes = 0;
+            if (parse_size(line, "nBYTES=", bytes))
+                zones_bytes += bytes;
+            zone = parse_quoted(line, "NAME=");
+            snapshot.mmz_valid = true;
+        }
+        else if (line.find("MMB:") != std::string::npos)
+        {
+            MmbRecord mmb = {0, 0, 0, parse_quoted(line, "name="), zone};
+            if (!parse_phys(line, "phys(", mmb.phys_start, mmb.phys_end))
+                continue;
+            if (!parse_size(line, "length=", mmb.bytes))
+                mmb.bytes = mmb.phys_end - mmb.phys_start + 1;
+            snapshot.mmz_used_bytes += mmb.bytes;
+            snapshot.mmbs.push_back(mmb);
+        }
+        else if (parse_size(line, "total size=", summary_total))
+        {
+            snapshot.mmz_valid = true;
+        }
+    }
+    snapshot.mmz_total_bytes = summary_total ? summary_total : zones_bytes;
+    return snapshot.mmz_valid;
+}
+
+MemSnapshot MemAccounting::snapshot()
+{
+    MemSnapshot snapshot = {false, 0, 0, {}, 0, 0};
+    const char *fixture = getenv("K230_MEDIA_MEM_FILE");
+    std::ifstream media_mem(fixture && fixture[0] ? fixture : "/proc/media-mem");
+    if (media_mem)
+        parse_media_mem(media_mem, snapshot);
+
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        uint64_t kb = 0;
+        if (line.compare(0, 6, "VmRSS:") == 0 && parse_number(line, "VmRSS:", kb))
+            snapshot.rss_bytes = kb * 1024;
+        else if (line.compare(0, 6, "VmHWM:") == 0 && parse_number(line, "VmHWM:", kb))
+            snapshot.rss_peak_bytes = kb * 1024;
+    }
+    return snapshot;
+}
+
+MemDelta MemAccounting::diff(const MemSnapshot &before, const MemSnapshot &after)
+{
+    MemDelta delta;
+    delta.mmz_bytes = (int64_t)after.mmz_used_bytes - (int64_t)before.mmz_used_bytes;
+    delta.rss_bytes = (int64_t)after.rss_bytes - (int64_t)before.rss_bytes;
+
+    std::set<uint64_t> before_starts, after_starts;
+    for (const MmbRecord &mmb : before.mmbs)
+        before_starts.insert(mmb.phys_start);
+    for (const MmbRecord &mmb : after.mmbs)
+    {
+        after_starts.insert(mmb.phys_start);
+        if (!before_starts.count(mmb.phys_start))
+            delta.added.push_back(mmb);
+    }
+    for (const MmbRecord &mmb : before.mmbs)
+        if (!after_starts.count(mmb.phys_start))
+            delta.freed.push_back(mmb);
+    return delta;
+}
+
+MemTracker::MemTracker(const std::string &owner, bool enable)
+    : owner_(owner), enabled_(enable), peak_mmz_bytes_(0), peak_rss_bytes_(0), steady_mmz_bytes_(0), steady_rss_bytes_(0)
+{
+    if (enabled_)
+        base_ = last_ = MemAccounting::snapshot();
+}
+
+bool MemTracker::env_enabled()
+{
+    const char *env = getenv("K230_MEM_ACCOUNTING");
+    return env && atoi(env) > 0;
+}
+
+void MemTracker::mark(const std::string &phase)
+{
+    if (!enabled_)
+        return;
+    MemSnapshot now = MemAccounting::snapshot();
+    phases_.push_back({phase, MemAccounting::diff(last_, now)});
+    last_ = now;
+
+    steady_mmz_bytes_ = (int64_t)now.mmz_used_bytes - (int64_t)base_.mmz_used_bytes;
+    steady_rss_bytes_ = (int64_t)now.rss_bytes - (int64_t)base_.rss_bytes;
+    peak_mmz_bytes_ = std::max(peak_mmz_bytes_, steady_mmz_bytes_);
+    // VmHWM是进程级峰值，只能近似反映本对象的堆峰值
+    peak_rss_bytes_ = std::max(peak_rss_bytes_, std::max(steady_rss_bytes_, (int64_t)now.rss_peak_bytes - (int64_t)base_.rss_peak_bytes));
+}
+
+void MemTracker::report(std::ostream &os) const
+{
+    if (!enabled_)
+        return;
+    char buf[256];
+    os << "[" << owner_ << "] memory" << (base_.mmz_valid ? "" : " (media-mem not available, mmz not counted)") << std::endl;
+    for (const Phase &phase : phases_)
+    {
+        snprintf(buf, sizeof(buf), "  %-16s mmz %+9.1f KB (+%zu/-%zu blocks), rss %+9.1f KB",
+                 phase.name.c_str(), phase.delta.mmz_bytes / 1024.0, phase.delta.added.size(), phase.delta.freed.size(),
+                 phase.delta.rss_bytes / 1024.0);
+        os << buf << std::endl;
+        for (const MmbRecord &mmb : phase.delta.added)
+        {
+            snprintf(buf, sizeof(buf), "    + 0x%08llx %9.1f KB  %s", (unsigned long long)mmb.phys_start, mmb.bytes / 1024.0, mmb.name.c_str());
+            os << buf << std::endl;
+        }
+        for (const MmbRecord &mmb : phase.delta.freed)
+        {
+            snprintf(buf, sizeof(buf), "    - 0x%08llx %9.1f KB  %s", (unsigned long long)mmb.phys_start, mmb.bytes / 1024.0, mmb.name.c_str());
+            os << buf << std::endl;
+        }
+    }
+    snprintf(buf, sizeof(buf), "  total: mmz peak %+.1f KB, steady %+.1f KB; rss peak %+.1f KB, steady %+.1f KB; mmz used %.1f / %.1f KB",
+             peak_mmz_bytes_ / 1024.0, steady_mmz_bytes_ / 1024.0, peak_rss_bytes_ / 1024.0, steady_rss_bytes_ / 1024.0,
+             last_.mmz_used_bytes / 1024.0, last_.mmz_total_bytes / 1024.0);
+    os << buf << std::endl;
+}
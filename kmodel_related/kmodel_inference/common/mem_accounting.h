@@ -0,0 +1,186 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _MEM_ACCOUNTING_H
+#define _MEM_ACCOUNTING_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief /proc/media-mem中的一条MMB（一次mmz分配）
+ * 对应行形如：|-MMB: phys(0x10000000, 0x10000FFF), kvirt=0x0, flags=0x00000000, length=4KB,    name="vb_pool"
+ */
+struct MmbRecord
+{
+    uint64_t phys_start; // 起始物理地址
+    uint64_t phys_end;   // 结束物理地址（含）
+    uint64_t bytes;      // 分配大小
+    std::string name;    // 分配时的名称
+    std::string zone;    // 所属zone名称
+};
+
+/**
+ * @brief 某一时刻的内存状态
+ */
+struct MemSnapshot
+{
+    bool mmz_valid;               // 是否成功读取了media-mem
+    uint64_t mmz_total_bytes;     // mmz总大小（汇总行total size，没有汇总行时为各zone大小之和）
+    uint64_t mmz_used_bytes;      // mmz已用（各MMB大小之和）
+    std::vector<MmbRecord> mmbs;  // 所有MMB
+    uint64_t rss_bytes;           // 进程VmRSS（/proc/self/status），用于估计堆内存
+    uint64_t rss_peak_bytes;      // 进程VmHWM
+};
+
+/**
+ * @brief 两个时刻之间的内存变化
+ */
+struct MemDelta
+{
+    int64_t mmz_bytes;              // mmz用量变化
+    int64_t rss_bytes;              // VmRSS变化
+    std::vector<MmbRecord> added;   // 新增的MMB
+    std::vector<MmbRecord> freed;   // 释放的MMB
+};
+
+/**
+ * @brief media-mem解析与内存快照
+ * 默认读取/proc/media-mem和/proc/self/status；设置环境变量K230_MEDIA_MEM_FILE时改为读取该文件（主机上用保存下来的fixture调试）
+ */
+class MemAccounting
+{
+public:
+    /**
+     * @brief 解析media-mem文本
+     * @param in       media-mem内容
+     * @param snapshot 解析结果（mmz相关字段）
+     * @return 读到至少一个zone或汇总行返回true
+     */
+    static bool parse_media_mem(std::istream &in, MemSnapshot &snapshot);
+
+    /**
+     * @brief 获取当前内存快照
+     * @return 快照，media-mem不可读时mmz_valid为false
+     */
+    static MemSnapshot snapshot();
+
+    /**
+     * @brief 计算两个快照之间的变化，MMB按起始物理地址对应
+     * @param before 之前的快照
+     * @param after  之后的快照
+     * @return 变化
+     */
+    static MemDelta diff(const MemSnapshot &before, const MemSnapshot &after);
+};
+
+/**
+ * @brief 按阶段记录某个对象（如AIBase实例）的内存变化
+ * 构造时取基准快照，每次mark取一次快照并记录与上一次的差；report输出各阶段的mmz/堆变化以及峰值和稳定值。
+ * 未开启时mark和report都不做任何事，不读/proc。
+ */
+class MemTracker
+{
+public:
+    /**
+     * @brief MemTracker构造函数
+     * @param owner  对象名称（如模型名）
+     * @param enable 是否开启
+     * @return None
+     */
+    MemTracker(const std::string &owner, bool enable);
+
+    /**
+     * @brief 是否由环境变量K230_MEM_ACCOUNTING=1要求开启
+     * @return 要求开启返回true
+     */
+    static bool env_enabled();
+
+    bool enabled() const
+    {
+        return enabled_;
+    }
+
+    /**
+     * @brief 记录一个阶段结束时的内存状态
+     * @param phase 阶段名称，如load_model、input tensors、ai2d builder
+     * @return None
+     */
+    void mark(const std::string &phase);
+
+    /**
+     * @brief mmz峰值相对基准的增量
+     * @return 字节数
+     */
+    int64_t peak_mmz_bytes() const
+    {
+        return peak_mmz_bytes_;
+    }
+
+    /**
+     * @brief 最近一次mark时mmz相对基准的增量（稳定值）
+     * @return 字节数
+     */
+    int64_t steady_mmz_bytes() const
+    {
+        return steady_mmz_bytes_;
+    }
+
+    /**
+     * @brief 最近一次mark时VmRSS相对基准的增量
+     * @return 字节数
+     */
+    int64_t steady_rss_bytes() const
+    {
+        return steady_rss_bytes_;
+    }
+
+    /**
+     * @brief 输出各阶段的内存变化
+     * @param os 输出流
+     * @return None
+     */
+    void report(std::ostream &os = std::cout) const;
+
+private:
+    struct Phase
+    {
+        std::string name;
+        MemDelta delta;
+    };
+
+    std::string owner_;
+    bool enabled_;
+    MemSnapshot base_;           // 基准快照
+    MemSnapshot last_;           // 最近一次快照
+    std::vector<Phase> phases_;  // 各阶段的变化
+    int64_t peak_mmz_bytes_;     // mmz峰值增量
+    int64_t peak_rss_bytes_;     // VmRSS峰值增量
+    int64_t steady_mmz_bytes_;   // mmz稳定增量
+    int64_t steady_rss_bytes_;   // VmRSS稳定增量
+};
+
+#endif
@@ -0,0 +1,389 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "metrics.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "scoped_timing.hpp"
+#include "mem_accounting.h"
+
+Histogram::Histogram(const std::vector<double> &bounds)
+    : bounds_(bounds), counts_(new std::atomic<uint64_t>[bounds.size() + 1]), sum_(0)
+{
+    for (size_t i = 0; i <= bounds_.size(); i++)
+        counts_[i].store(0, std::memory_order_relaxed);
+}
+
+void Histogram::observe(double v)
+{
+    size_t i = 0;
+    while (i < bounds_.size() && v > bounds_[i])
+        i++;
+    counts_[i].fetch_add(1, std::memory_order_relaxed);
+    double old_sum = sum_.load(std::memory_order_relaxed);
+    while (!sum_.compare_exchange_weak(old_sum, old_sum + v, std::memory_order_relaxed))
+        ;
+}
+
+std::vector<uint64_t> Histogram::cumulative_counts() const
+{
+    std::vector<uint64_t> counts(bounds_.size() + 1);
+    uint64_t total = 0;
+    for (size_t i = 0; i <= bounds_.size(); i++)
+    {
+        total += counts_[i].load(std::memory_order_relaxed);
+        counts[i] = total;
+    }
+    return counts;
+}
+
+Metrics &Metrics::instance()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+Metrics::Metrics() : enabled_(false), period_ms_(1000), listen_fd_(-1), stop_(false)
+{
+    for (int i = 0; i < kMaxStages; i++)
+        stages_[i].store(nullptr, std::memory_order_relaxed);
+
+    const char *file = getenv("K230_METRICS_FILE");
+    const char *socket_path = getenv("K230_METRICS_SOCKET");
+    const char *period = getenv("K230_METRICS_PERIOD_MS");
+    if ((file && file[0]) || (socket_path && socket_path[0]))
+        start(file ? file : "", socket_path ? socket_path : "", period ? atoi(period) : 1000);
+}
+
+Metrics::~Metrics()
+{
+    stop();
+}
+
+Metrics::Entry &Metrics::find_or_add(const std::string &name, const std::string &help, const std::string &labels, Type type)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &e : entries_)
+    {
+        if (e->name == name && e->labels == labels)
+        {
+            if (e->type != type)
+            {
+                std::cerr << "metric " << name << "{" << labels << "} registered with another type" << std::endl;
+                std::abort();
+            }
+            return *e;
+        }
+    }
+    std::unique_ptr<Entry> e(new Entry);
+    e->name = name;
+    e->help = help;
+    e->labels = labels;
+    e->type = type;
+    entries_.push_back(std::move(e));
+    return *entries_.back();
+}
+
+Counter &Metrics::counter(const std::string &name, const std::string &help, const std::string &labels)
+{
+    Entry &e = find_or_add(name, help, labels, COUNTER);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!e.counter)
+        e.counter.reset(new Counter);
+    return *e.counter;
+}
+
+Gauge &Metrics::gauge(const std::string &name, const std::string &help, const std::string &labels)
+{
+    Entry &e = find_or_add(name, help, labels, GAUGE);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!e.gauge)
+        e.gauge.reset(new Gauge);
+    return *e.gauge;
+}
+
+Histogram &Metrics::histogram(const std::string &name, const std::string &help, const std::string &labels, const std::vector<double> &bounds)
+{
+    Entry &e = find_or_add(name, help, labels, HISTOGRAM);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!e.histogram)
+    {
+        // 默认分桶按毫秒耗时划分，覆盖ai2d（<1ms）到整帧（数百ms）
+        static const std::vector<double> default_bounds = {0.5, 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000};
+        e.histogram.reset(new Histogram(bounds.empty() ? default_bounds : bounds));
+    }
+    return *e.histogram;
+}
+
+static std::string escape_label_value(const std::string &s)
+{
+    std::string out;
+    for (char c : s)
+    {
+        if (c == '\\' || c == '"')
+            out += '\\';
+        if (c == '\n')
+        {
+            out += "\\n";
+            continue;
+        }
+        out += c;
+    }
+    return out;
+}
+
+// name{labels,extra}，labels或extra为空时省略
+static std::string series(const std::string &name, const std::string &labels, const std::string &extra = "")
+{
+    std::string s = name;
+    if (labels.empty() && extra.empty())
+        return s;
+    s += "{" + labels;
+    if (!labels.empty() && !extra.empty())
+        s += ",";
+    s += extra + "}";
+    return s;
+}
+
+std::string Metrics::render()
+{
+    static const char *type_names[] = {"counter", "gauge", "histogram"};
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string out;
+    char buf[64];
+    std::vector<bool> done(entries_.size(), false);
+    // 同名指标（不同标签）放在一起，HELP/TYPE只输出一次
+    for (size_t i = 0; i < entries_.size(); i++)
+    {
+        if (done[i])
+            continue;
+        const Entry &first = *entries_[i];
+        out += "# HELP " + first.name + " " + first.help + "\n";
+        out += "# TYPE " + first.name + " " + type_names[first.type] + "\n";
+        for (size_t j = i; j < entries_.size(); j++)
+        {
+            const Entry &e = *entries_[j];
+            if (done[j] || e.name != first.name)
+                continue;
+            done[j] = true;
+            if (e.counter)
+            {
+                snprintf(buf, sizeof(buf), " %llu\n", (unsigned long long)e.counter->value());
+                out += series(e.name, e.labels) + buf;
+            }
+            else if (e.gauge)
+            {
+                snprintf(buf, sizeof(buf), " %.6g\n", e.gauge->value());
+                out += series(e.name, e.labels) + buf;
+            }
+            else if (e.histogram)
+            {
+                std::vector<uint64_t> counts = e.histogram->cumulative_counts();
+                const std::vector<double> &bounds = e.histogram->bounds();
+                for (size_t k = 0; k < counts.size(); k++)
+                {
+                    if (k < bounds.size())
+                        snprintf(buf, sizeof(buf), "le=\"%g\"", bounds[k]);
+                    else
+                        snprintf(buf, sizeof(buf), "le=\"+Inf\"");
+                    out += series(e.name + "_bucket", e.labels, buf);
+                    snprintf(buf, sizeof(buf), " %llu\n", (unsigned long long)counts[k]);
+                    out += buf;
+                }
+                snprintf(buf, sizeof(buf), " %.6g\n", e.histogram->sum());
+                out += series(e.name + "_sum", e.labels) + buf;
+                snprintf(buf, sizeof(buf), " %llu\n", (unsigned long long)counts.back());
+                out += series(e.name + "_count", e.labels) + buf;
+            }
+        }
+    }
+    return out;
+}
+
+bool Metrics::write_file(const std::string &file_name)
+{
+    // 先写临时文件再rename，采集端不会读到写了一半的文件
+    std::string tmp = file_name + ".tmp";
+    std::string text = render();
+    FILE *fp = fopen(tmp.c_str(), "w");
+    if (fp == nullptr)
+    {
+        std::cerr << "open " << tmp << " failed: " << strerror(errno) << std::endl;
+        return false;
+    }
+    bool ok = fwrite(text.data(), 1, text.size(), fp) == text.size();
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok || rename(tmp.c_str(), file_name.c_str()) != 0)
+    {
+        std::cerr << "write " << file_name << " failed: " << strerror(errno) << std::endl;
+        unlink(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+void Metrics::collect_board_state()
+{
+    MemSnapshot mem = MemAccounting::snapshot();
+    if (mem.mmz_valid)
+    {
+        gauge("k230_mmz_total_bytes", "MMZ size reported by /proc/media-mem").set(mem.mmz_total_bytes);
+        gauge("k230_mmz_used_bytes", "MMZ in use, sum of MMB blocks in /proc/media-mem").set(mem.mmz_used_bytes);
+        gauge("k230_mmz_blocks", "MMB blocks in /proc/media-mem").set(mem.mmbs.size());
+    }
+    gauge("k230_process_rss_bytes", "VmRSS of this process").set(mem.rss_bytes);
+}
+
+void Metrics::observe_timing(int label, float elapsed_ms)
+{
+    if (label < 0 || label >= kMaxStages)
+        return;
+    Metrics &m = instance();
+    Histogram *h = m.stages_[label].load(std::memory_order_acquire);
+    if (h == nullptr)
+    {
+        h = &m.histogram("k230_stage_duration_ms", "ScopedTiming duration of each pipeline stage in milliseconds",
+                         "stage=\"" + escape_label_value(TimingLabel::lookup(label)) + "\"");
+        m.stages_[label].store(h, std::memory_order_release);
+    }
+    h->observe(elapsed_ms);
+}
+
+void Metrics::start(const std::string &file_name, const std::string &socket_path, int period_ms)
+{
+    if (enabled_)
+        return;
+    file_name_ = file_name;
+    socket_path_ = socket_path;
+    period_ms_ = period_ms > 0 ? period_ms : 1000;
+
+    if (!socket_path_.empty())
+    {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (socket_path_.size() >= sizeof(addr.sun_path))
+        {
+            std::cerr << "metrics socket path too long: " << socket_path_ << std::endl;
+            socket_path_.clear();
+        }
+        else
+        {
+            strcpy(addr.sun_path, socket_path_.c_str());
+            unlink(socket_path_.c_str());
+            listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (listen_fd_ < 0 || bind(listen_fd_, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(listen_fd_, 4) != 0)
+            {
+                std::cerr << "metrics socket " << socket_path_ << " failed: " << strerror(errno) << std::endl;
+                if (listen_fd_ >= 0)
+                    close(listen_fd_);
+                listen_fd_ = -1;
+                socket_path_.clear();
+            }
+        }
+    }
+    if (file_name_.empty() && socket_path_.empty())
+        return;
+
+    enabled_ = true;
+    ScopedTiming::set_observer(&Metrics::observe_timing);
+    stop_ = false;
+    thread_ = std::thread(&Metrics::serve_loop, this);
+}
+
+void Metrics::stop()
+{
+    if (!enabled_)
+        return;
+    ScopedTiming::set_observer(nullptr);
+    stop_ = true;
+    if (thread_.joinable())
+        thread_.join();
+    if (listen_fd_ >= 0)
+    {
+        close(listen_fd_);
+        unlink(socket_path_.c_str());
+        listen_fd_ = -1;
+    }
+    if (!file_name_.empty())
+        write_file(file_name_);
+    enabled_ = false;
+}
+
+void Metrics::serve_loop()
+{
+    const int poll_ms = 100; // stop()最多等待这么久
+    auto next = std::chrono::steady_clock::now();
+    while (!stop_)
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next)
+        {
+            collect_board_state();
+            if (!file_name_.empty())
+                write_file(file_name_);
+            next = now + std::chrono::milliseconds(period_ms_);
+        }
+
+        if (listen_fd_ < 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(poll_ms));
+            continue;
+        }
+
+        pollfd pfd = {listen_fd_, POLLIN, 0};
+        if (poll(&pfd, 1, poll_ms) <= 0 || !(pfd.revents & POLLIN))
+            continue;
+        int fd = accept(listen_fd_, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+        // 不解析请求，任何请求都返回全部指标；请求读不到也照样应答，方便socat等工具直接读取
+        pollfd cfd = {fd, POLLIN, 0};
+        char req[1024];
+        if (poll(&cfd, 1, poll_ms) > 0)
+            (void)!read(fd, req, sizeof(req));
+        std::string body = render();
+        std::string resp = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " +
+                           std::to_string(body.size()) + "\r\n\r\n" + body;
+        size_t sent = 0;
+        while (sent < resp.size())
+        {
+            ssize_t n = send(fd, resp.data() + sent, resp.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0)
+                break;
+            sent += n;
+        }
+        close(fd);
+    }
+}
@@ -0,0 +1,259 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _METRICS_H
+#define _METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 单调递增计数器（帧数、丢帧数等）
+ */
+class Counter
+{
+public:
+    Counter() : value_(0) {}
+
+    /**
+     * @brief 计数增加
+     * @param n 增加量
+     * @return None
+     */
+    void inc(uint64_t n = 1)
+    {
+        value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> value_;
+};
+
+/**
+ * @brief 瞬时值（帧率、mmz用量等）
+ */
+class Gauge
+{
+public:
+    Gauge() : value_(0) {}
+
+    /**
+     * @brief 设置当前值
+     * @param v 当前值
+     * @return None
+     */
+    void set(double v)
+    {
+        value_.store(v, std::memory_order_relaxed);
+    }
+
+    double value() const
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<double> value_;
+};
+
+/**
+ * @brief 固定分桶的直方图（各阶段耗时），observe只做原子加，不加锁
+ */
+class Histogram
+{
+public:
+    /**
+     * @brief Histogram构造函数
+     * @param bounds 各桶上界（升序），另有一个+Inf桶
+     * @return None
+     */
+    explicit Histogram(const std::vector<double> &bounds);
+
+    /**
+     * @brief 记录一个观测值
+     * @param v 观测值
+     * @return None
+     */
+    void observe(double v);
+
+    const std::vector<double> &bounds() const
+    {
+        return bounds_;
+    }
+
+    /**
+     * @brief 各桶的累计计数（le语义），最后一个为+Inf
+     * @return 累计计数
+     */
+    std::vector<uint64_t> cumulative_counts() const;
+
+    double sum() const
+    {
+        return sum_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<double> bounds_;
+    std::unique_ptr<std::atomic<uint64_t>[]> counts_; // bounds_.size()+1个桶
+    std::atomic<double> sum_;
+};
+
+/**
+ * @brief 指标注册表，以Prometheus文本格式导出
+ * 环境变量K230_METRICS_FILE=xxx.prom：后台线程每K230_METRICS_PERIOD_MS（默认1000）毫秒重写一次该文件（先写临时文件再rename，
+ * 可直接交给node_exporter的textfile collector）；K230_METRICS_SOCKET=xxx.sock：在该Unix socket上应答HTTP请求
+ * （curl --unix-socket xxx.sock http://localhost/metrics）。两者都未设置时不启动后台线程，ScopedTiming也不会上报。
+ * 开启后所有ScopedTiming的耗时计入k230_stage_duration_ms{stage="计时名称"}，并周期性采集k230_mmz_used_bytes等板级状态。
+ */
+class Metrics
+{
+public:
+    /**
+     * @brief 获取全局注册表，首次调用时读取环境变量并启动导出线程
+     * @return 全局注册表
+     */
+    static Metrics &instance();
+
+    /**
+     * @brief 是否在导出（设置了文件或socket）
+     * @return 导出中返回true
+     */
+    bool enabled() const
+    {
+        return enabled_;
+    }
+
+    /**
+     * @brief 获取（不存在则创建）计数器
+     * @param name   指标名称，如k230_frames_total
+     * @param help   指标说明
+     * @param labels 标签，如thread="inference"，可为空
+     * @return 计数器，地址在程序运行期间不变
+     */
+    Counter &counter(const std::string &name, const std::string &help, const std::string &labels = "");
+
+    /**
+     * @brief 获取（不存在则创建）瞬时值
+     * @param name   指标名称
+     * @param help   指标说明
+     * @param labels 标签，可为空
+     * @return 瞬时值，地址在程序运行期间不变
+     */
+    Gauge &gauge(const std::string &name, const std::string &help, const std::string &labels = "");
+
+    /**
+     * @brief 获取（不存在则创建）直方图
+     * @param name   指标名称
+     * @param help   指标说明
+     * @param labels 标签，可为空
+     * @param bounds 各桶上界，为空时使用毫秒耗时的默认分桶
+     * @return 直方图，地址在程序运行期间不变
+     */
+    Histogram &histogram(const std::string &name, const std::string &help, const std::string &labels = "",
+                         const std::vector<double> &bounds = std::vector<double>());
+
+    /**
+     * @brief 按Prometheus文本格式输出所有指标
+     * @return 指标文本
+     */
+    std::string render();
+
+    /**
+     * @brief 立即重写一次指标文件
+     * @param file_name 指标文件
+     * @return 成功返回true
+     */
+    bool write_file(const std::string &file_name);
+
+    /**
+     * @brief 开始导出，file_name/socket_path为空时不启用对应方式；重复调用无效
+     * @param file_name   周期重写的指标文件
+     * @param socket_path Unix socket路径
+     * @param period_ms   重写文件和采集板级状态的周期
+     * @return None
+     */
+    void start(const std::string &file_name, const std::string &socket_path, int period_ms = 1000);
+
+    /**
+     * @brief 停止导出线程，并最后写一次文件
+     * @return None
+     */
+    void stop();
+
+    ~Metrics();
+
+private:
+    enum Type
+    {
+        COUNTER,
+        GAUGE,
+        HISTOGRAM,
+    };
+
+    struct Entry
+    {
+        std::string name;
+        std::string help;
+        std::string labels;
+        Type type;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    Metrics();
+    Metrics(const Metrics &) = delete;
+    Metrics &operator=(const Metrics &) = delete;
+
+    Entry &find_or_add(const std::string &name, const std::string &help, const std::string &labels, Type type);
+    void collect_board_state();
+    void serve_loop();
+    static void observe_timing(int label, float elapsed_ms);
+
+    static const int kMaxStages = 256;                    // ScopedTiming计时名称编号上限，超出的不统计
+    std::atomic<Histogram *> stages_[kMaxStages];         // 按TimingLabel编号索引的阶段耗时直方图
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Entry>> entries_;
+
+    bool enabled_;
+    std::string file_name_;
+    std::string socket_path_;
+    int period_ms_;
+    int listen_fd_;
+    std::atomic<bool> stop_;
+    std::thread thread_;
+};
+
+#endif
@@ -0,0 +1,126 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "motion_gate.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+MotionGate::MotionGate(float change_ratio, int max_skip, int pixel_thresh, int grid_w, int grid_h)
+    : change_ratio_(change_ratio), max_skip_(max_skip), pixel_thresh_(pixel_thresh), grid_w_(grid_w), grid_h_(grid_h),
+      grid_(grid_w * grid_h), force_(false), skip_count_(0), change_(1.f), inferred_(0), skipped_(0)
+{
+}
+
+// 每个格子取中心2x2像素的平均，比单点采样抗噪，读的数据量仍只有grid_w*grid_h*4个像素
+bool MotionGate::update_luma(const uint8_t *y, int width, int height, int stride)
+{
+    for (int gy = 0; gy < grid_h_; gy++)
+    {
+        int py = std::min((2 * gy + 1) * height / (2 * grid_h_), height - 2);
+        const uint8_t *row0 = y + (size_t)py * stride;
+        const uint8_t *row1 = row0 + stride;
+        for (int gx = 0; gx < grid_w_; gx++)
+        {
+            int px = std::min((2 * gx + 1) * width / (2 * grid_w_), width - 2);
+            grid_[gy * grid_w_ + gx] = (row0[px] + row0[px + 1] + row1[px] + row1[px + 1] + 2) >> 2;
+        }
+    }
+    return decide();
+}
+
+bool MotionGate::update_rgb_planar(const uint8_t *chw, int width, int height)
+{
+    size_t plane = (size_t)width * height;
+    const uint8_t *r = chw;
+    const uint8_t *g = chw + plane;
+    const uint8_t *b = chw + 2 * plane;
+    for (int gy = 0; gy < grid_h_; gy++)
+    {
+        int py = std::min((2 * gy + 1) * height / (2 * grid_h_), height - 2);
+        for (int gx = 0; gx < grid_w_; gx++)
+        {
+            int px = std::min((2 * gx + 1) * width / (2 * grid_w_), width - 2);
+            size_t i0 = (size_t)py * width + px;
+            size_t i1 = i0 + width;
+            int sum_r = r[i0] + r[i0 + 1] + r[i1] + r[i1 + 1];
+            int sum_g = g[i0] + g[i0 + 1] + g[i1] + g[i1 + 1];
+            int sum_b = b[i0] + b[i0 + 1] + b[i1] + b[i1 + 1];
+            // y = 0.299r + 0.587g + 0.114b，定点77/150/29，再除以4个像素
+            grid_[gy * grid_w_ + gx] = (77 * sum_r + 150 * sum_g + 29 * sum_b + 512) >> 10;
+        }
+    }
+    return decide();
+}
+
+bool MotionGate::decide()
+{
+    bool first = reference_.empty();
+    if (!first)
+    {
+        int changed = 0;
+        for (size_t i = 0; i < grid_.size(); i++)
+        {
+            if (std::abs(grid_[i] - reference_[i]) > pixel_thresh_)
+                changed++;
+        }
+        change_ = (float)changed / grid_.size();
+    }
+
+    bool infer = first || force_ || change_ratio_ <= 0 || skip_count_ >= max_skip_ || change_ >= change_ratio_;
+    if (infer)
+    {
+        // 与上次检测时比较而不是与上一帧比较，缓慢移动累积起来也会触发检测
+        reference_ = grid_;
+        force_ = false;
+        skip_count_ = 0;
+        inferred_++;
+    }
+    else
+    {
+        skip_count_++;
+        skipped_++;
+    }
+    return infer;
+}
+
+void MotionGate::force()
+{
+    force_ = true;
+}
+
+float MotionGate::change() const
+{
+    return change_;
+}
+
+uint64_t MotionGate::inferred() const
+{
+    return inferred_;
+}
+
+uint64_t MotionGate::skipped() const
+{
+    return skipped_;
+}
@@ -0,0 +1,109 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _MOTION_GATE_H
+#define _MOTION_GATE_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 基于帧间变化的检测跳帧
+ * 把isp帧的亮度降采样到grid_w*grid_h的小图，与上次跑检测时的小图比较，
+ * 变化的格子比例低于阈值时跳过本帧的检测，沿用上次的结果或跟踪预测
+ */
+class MotionGate
+{
+public:
+    /**
+     * @brief MotionGate构造函数
+     * @param change_ratio  变化格子占比达到该值时跑检测，<=0表示不跳帧（每帧都检测）
+     * @param max_skip      最多连续跳过的帧数，之后强制检测一次
+     * @param pixel_thresh  格子亮度差超过该值才算变化，过滤sensor噪声
+     * @param grid_w        降采样小图宽
+     * @param grid_h        降采样小图高
+     * @return None
+     */
+    MotionGate(float change_ratio = 0.01f, int max_skip = 15, int pixel_thresh = 10, int grid_w = 64, int grid_h = 36);
+
+    /**
+     * @brief 输入一帧亮度平面（nv12的y平面），判断是否需要检测
+     * @param y       亮度平面
+     * @param width   宽
+     * @param height  高
+     * @param stride  行跨度（字节）
+     * @return 需要检测返回true
+     */
+    bool update_luma(const uint8_t *y, int width, int height, int stride);
+
+    /**
+     * @brief 输入一帧rgb888 planar（chw）数据，按BT.601系数算亮度后判断是否需要检测
+     * @param chw     rgb planar数据
+     * @param width   宽
+     * @param height  高
+     * @return 需要检测返回true
+     */
+    bool update_rgb_planar(const uint8_t *chw, int width, int height);
+
+    /**
+     * @brief 下一帧强制检测（如人脸注册、数据库重置之后）
+     * @return None
+     */
+    void force();
+
+    /**
+     * @brief 最近一帧的变化格子占比
+     * @return 0~1
+     */
+    float change() const;
+
+    /**
+     * @brief 跑检测的帧数
+     */
+    uint64_t inferred() const;
+
+    /**
+     * @brief 跳过检测的帧数
+     */
+    uint64_t skipped() const;
+
+private:
+    // 比较grid_与reference_，决定本帧是否检测
+    bool decide();
+
+    float change_ratio_;
+    int max_skip_;
+    int pixel_thresh_;
+    int grid_w_;
+    int grid_h_;
+    std::vector<uint8_t> grid_;      // 本帧降采样亮度
+    std::vector<uint8_t> reference_; // 上次检测时的降采样亮度
+    bool force_;
+    int skip_count_;
+    float change_;
+    uint64_t inferred_;
+    uint64_t skipped_;
+};
+
+#endif
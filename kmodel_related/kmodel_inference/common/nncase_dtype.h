@@ -0,0 +1,82 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _NNCASE_DTYPE_H
+#define _NNCASE_DTYPE_H
+
+#include <nncase/runtime/datatypes.h>
+#include "output_compare.h"
+
+/**
+ * @brief nncase的typecode转OutputCompare使用的数据类型
+ * @param typecode nncase数据类型（interp.output_desc(i).datatype）
+ * @param dtype    对应的比较数据类型
+ * @return 支持比较返回true（boolean、utf8char等返回false）
+ */
+inline bool to_tensor_dtype(nncase::typecode_t typecode, TensorDType &dtype)
+{
+    switch (typecode)
+    {
+    case nncase::dt_uint8:
+        dtype = DT_UINT8;
+        return true;
+    case nncase::dt_int8:
+        dtype = DT_INT8;
+        return true;
+    case nncase::dt_uint16:
+        dtype = DT_UINT16;
+        return true;
+    case nncase::dt_int16:
+        dtype = DT_INT16;
+        return true;
+    case nncase::dt_uint32:
+        dtype = DT_UINT32;
+        return true;
+    case nncase::dt_int32:
+        dtype = DT_INT32;
+        return true;
+    case nncase::dt_uint64:
+        dtype = DT_UINT64;
+        return true;
+    case nncase::dt_int64:
+        dtype = DT_INT64;
+        return true;
+    case nncase::dt_float16:
+        dtype = DT_FLOAT16;
+        return true;
+    case nncase::dt_bfloat16:
+        dtype = DT_BFLOAT16;
+        return true;
+    case nncase::dt_float32:
+        dtype = DT_FLOAT32;
+        return true;
+    case nncase::dt_float64:
+        dtype = DT_FLOAT64;
+        return true;
+    default:
+        return false;
+    }
+}
+
+#endif
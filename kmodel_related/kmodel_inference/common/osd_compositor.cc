@@ -0,0 +1,99 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cstring>
+#include <opencv2/imgproc.hpp>
+#include "osd_compositor.h"
+
+#define OSD_PIXEL_SIZE (4)
+
+OsdCompositor::OsdCompositor(int width, int height, const std::vector<void *> &buffers)
+    : width_(width), height_(height), buffers_(buffers), dirty_(buffers.size()), initialized_(buffers.size(), false), current_(-1), bytes_touched_(0)
+{
+}
+
+cv::Mat &OsdCompositor::begin_frame()
+{
+    current_ = (current_ + 1) % buffers_.size();
+    frame_ = cv::Mat(height_, width_, CV_8UC4, buffers_[current_]);
+    bytes_touched_ = 0;
+
+    if (!initialized_[current_])
+    {
+        // VB block中是上次使用留下的数据，第一次使用时清整帧
+        memset(buffers_[current_], 0, (size_t)width_ * height_ * OSD_PIXEL_SIZE);
+        bytes_touched_ += (size_t)width_ * height_ * OSD_PIXEL_SIZE;
+        initialized_[current_] = true;
+    }
+    else
+    {
+        for (auto &rect : dirty_[current_])
+            clear_rect(rect);
+    }
+    dirty_[current_].clear();
+    return frame_;
+}
+
+int OsdCompositor::end_frame()
+{
+    for (auto &rect : dirty_[current_])
+        bytes_touched_ += (size_t)rect.area() * OSD_PIXEL_SIZE;
+    return current_;
+}
+
+void OsdCompositor::mark_dirty(const cv::Rect &rect)
+{
+    cv::Rect clipped = rect & cv::Rect(0, 0, width_, height_);
+    if (clipped.area() > 0)
+        dirty_[current_].push_back(clipped);
+}
+
+void OsdCompositor::clear_rect(const cv::Rect &rect)
+{
+    size_t row_bytes = (size_t)rect.width * OSD_PIXEL_SIZE;
+    uint8_t *base = reinterpret_cast<uint8_t *>(buffers_[current_]);
+    for (int y = rect.y; y < rect.y + rect.height; ++y)
+        memset(base + ((size_t)y * width_ + rect.x) * OSD_PIXEL_SIZE, 0, row_bytes);
+    bytes_touched_ += row_bytes * rect.height;
+}
+
+void OsdCompositor::rectangle(const cv::Rect &rect, const cv::Scalar &color, int thickness)
+{
+    cv::rectangle(frame_, rect, color, thickness, cv::LINE_8, 0);
+    // 线宽向内外各扩展一半
+    int pad = thickness / 2 + 1;
+    mark_dirty(cv::Rect(rect.x - pad, rect.y - pad, rect.width + 2 * pad, rect.height + 2 * pad));
+}
+
+void OsdCompositor::circle(const cv::Point &center, int radius, const cv::Scalar &color, int thickness)
+{
+    cv::circle(frame_, center, radius, color, thickness);
+    int r = radius + thickness / 2 + 1;
+    mark_dirty(cv::Rect(center.x - r, center.y - r, 2 * r + 1, 2 * r + 1));
+}
+
+void OsdCompositor::put_text(const std::string &text, const cv::Point &org, int font_face, double font_scale, const cv::Scalar &color, int thickness)
+{
+    mark_dirty(text_renderer_.draw(frame_, text, org, font_face, font_scale, color, thickness));
+}
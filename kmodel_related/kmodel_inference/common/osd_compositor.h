@@ -0,0 +1,124 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _OSD_COMPOSITOR_H
+#define _OSD_COMPOSITOR_H
+
+#include <vector>
+#include <string>
+#include <opencv2/core.hpp>
+#include "text_renderer.h"
+
+/**
+ * @brief ARGB8888 osd合成器
+ * 直接在osd buffer（VB block映射地址或普通内存）上绘制，多个buffer轮流使用避免显示撕裂；
+ * 每个buffer记录上次画过的区域，下次使用时只清这些区域，不再每帧清整帧、拷贝整帧
+ */
+class OsdCompositor
+{
+public:
+    /**
+     * @brief OsdCompositor构造函数
+     * @param width    osd宽
+     * @param height   osd高
+     * @param buffers  osd buffer地址列表（每个width*height*4字节），一般为2个
+     * @return None
+     */
+    OsdCompositor(int width, int height, const std::vector<void *> &buffers);
+
+    /**
+     * @brief 开始一帧：切换到下一个buffer，并清掉该buffer上次画过的区域（首次使用时清整帧）
+     * @return 当前buffer对应的Mat（不拷贝数据）
+     */
+    cv::Mat &begin_frame();
+
+    /**
+     * @brief 结束一帧
+     * @return 本帧绘制完成、可以送显的buffer序号
+     */
+    int end_frame();
+
+    /**
+     * @brief 记录本帧画过的区域，会被裁剪到osd范围内
+     * @param rect 区域
+     * @return None
+     */
+    void mark_dirty(const cv::Rect &rect);
+
+    /**
+     * @brief 画矩形框并记录区域
+     * @param rect      矩形框
+     * @param color     颜色（B,G,R,A）
+     * @param thickness 线宽
+     * @return None
+     */
+    void rectangle(const cv::Rect &rect, const cv::Scalar &color, int thickness);
+
+    /**
+     * @brief 画圆并记录区域
+     * @param center    圆心
+     * @param radius    半径
+     * @param color     颜色（B,G,R,A）
+     * @param thickness 线宽
+     * @return None
+     */
+    void circle(const cv::Point &center, int radius, const cv::Scalar &color, int thickness);
+
+    /**
+     * @brief 写文字并记录区域，使用字形缓存绘制
+     * @param text       文字
+     * @param org        文字左下角
+     * @param font_face  字体
+     * @param font_scale 字体缩放
+     * @param color      颜色（B,G,R,A）
+     * @param thickness  线宽
+     * @return None
+     */
+    void put_text(const std::string &text, const cv::Point &org, int font_face, double font_scale, const cv::Scalar &color, int thickness);
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+    cv::Mat &frame() { return frame_; }
+
+    /**
+     * @brief 上一帧（begin_frame到end_frame之间）清除和绘制涉及的字节数
+     * @return 字节数
+     */
+    size_t bytes_touched() const { return bytes_touched_; }
+
+private:
+    void clear_rect(const cv::Rect &rect);
+
+    int width_;                                  // osd宽
+    int height_;                                 // osd高
+    std::vector<void *> buffers_;                // osd buffer列表
+    std::vector<std::vector<cv::Rect>> dirty_;   // 每个buffer上次画过的区域
+    std::vector<bool> initialized_;              // buffer是否清过整帧
+    int current_;                                // 当前绘制的buffer序号
+    cv::Mat frame_;                              // 当前buffer对应的Mat
+    size_t bytes_touched_;                       // 本帧清除和绘制涉及的字节数
+    TextRenderer text_renderer_;                 // 文字绘制（字形缓存）
+};
+
+#endif
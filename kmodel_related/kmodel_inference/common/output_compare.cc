@@ -0,0 +1,257 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "output_compare.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+static const char *kDTypeNames[] = {"uint8", "int8", "uint16", "int16", "uint32", "int32", "uint64", "int64",
+                                     "float16", "bfloat16", "float32", "float64"};
+
+static float half_to_float(uint16_t h)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t bits;
+    if (exp == 0)
+    {
+        if (mant == 0)
+        {
+            bits = sign;
+        }
+        else
+        {
+            // 非规格化数，规格化后再转
+            exp = 127 - 15 + 1;
+            while (!(mant & 0x400))
+            {
+                mant <<= 1;
+                exp--;
+            }
+            bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+        }
+    }
+    else if (exp == 0x1f)
+    {
+        bits = sign | 0x7f800000 | (mant << 13);
+    }
+    else
+    {
+        bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// 第i个元素解码成double，memcpy避免非对齐访问
+static double element(const unsigned char *p, size_t i, TensorDType dtype)
+{
+    switch (dtype)
+    {
+    case DT_UINT8:
+        return p[i];
+    case DT_INT8:
+        return (int8_t)p[i];
+#define K230_LOAD(type)                           \
+    {                                             \
+        type v;                                   \
+        memcpy(&v, p + i * sizeof(v), sizeof(v)); \
+        return (double)v;                         \
+    }
+    case DT_UINT16:
+        K230_LOAD(uint16_t)
+    case DT_INT16:
+        K230_LOAD(int16_t)
+    case DT_UINT32:
+        K230_LOAD(uint32_t)
+    case DT_INT32:
+        K230_LOAD(int32_t)
+    case DT_UINT64:
+        K230_LOAD(uint64_t)
+    case DT_INT64:
+        K230_LOAD(int64_t)
+    case DT_FLOAT32:
+        K230_LOAD(float)
+    case DT_FLOAT64:
+        K230_LOAD(double)
+#undef K230_LOAD
+    case DT_FLOAT16:
+    {
+        uint16_t h;
+        memcpy(&h, p + i * 2, 2);
+        return half_to_float(h);
+    }
+    case DT_BFLOAT16:
+    {
+        uint16_t h;
+        memcpy(&h, p + i * 2, 2);
+        uint32_t bits = (uint32_t)h << 16;
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+    }
+    return 0;
+}
+
+size_t OutputCompare::dtype_size(TensorDType dtype)
+{
+    switch (dtype)
+    {
+    case DT_UINT8:
+    case DT_INT8:
+        return 1;
+    case DT_UINT16:
+    case DT_INT16:
+    case DT_FLOAT16:
+    case DT_BFLOAT16:
+        return 2;
+    case DT_UINT32:
+    case DT_INT32:
+    case DT_FLOAT32:
+        return 4;
+    case DT_UINT64:
+    case DT_INT64:
+    case DT_FLOAT64:
+        return 8;
+    }
+    return 1;
+}
+
+bool OutputCompare::parse_dtype(const std::string &name, TensorDType &dtype)
+{
+    for (int i = 0; i < (int)(sizeof(kDTypeNames) / sizeof(kDTypeNames[0])); i++)
+    {
+        if (name == kDTypeNames[i])
+        {
+            dtype = (TensorDType)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *OutputCompare::dtype_name(TensorDType dtype)
+{
+    return kDTypeNames[dtype];
+}
+
+// 按值从大到小的前k个下标
+static std::vector<size_t> topk_indices(const std::vector<double> &values, int k)
+{
+    std::vector<size_t> idx(values.size());
+    std::iota(idx.begin(), idx.end(), 0);
+    k = std::min<int>(k, (int)idx.size());
+    std::partial_sort(idx.begin(), idx.begin() + k, idx.end(), [&](size_t a, size_t b) { return values[a] > values[b]; });
+    idx.resize(k);
+    std::sort(idx.begin(), idx.end());
+    return idx;
+}
+
+CompareResult OutputCompare::compare(const void *actual, const void *expected, size_t bytes, TensorDType dtype, int topk)
+{
+    CompareResult result;
+    const unsigned char *a = reinterpret_cast<const unsigned char *>(actual);
+    const unsigned char *e = reinterpret_cast<const unsigned char *>(expected);
+    result.count = bytes / dtype_size(dtype);
+    result.bit_exact = memcmp(a, e, bytes) == 0;
+    result.topk_agreement = -1;
+
+    double dot = 0, norm_a = 0, norm_e = 0, sq_err = 0, max_abs = 0;
+    std::vector<double> va, ve;
+    if (topk > 0)
+    {
+        va.resize(result.count);
+        ve.resize(result.count);
+    }
+    for (size_t i = 0; i < result.count; i++)
+    {
+        double x = element(a, i, dtype);
+        double y = element(e, i, dtype);
+        dot += x * y;
+        norm_a += x * x;
+        norm_e += y * y;
+        double d = std::fabs(x - y);
+        sq_err += d * d;
+        max_abs = std::max(max_abs, d);
+        if (topk > 0)
+        {
+            va[i] = x;
+            ve[i] = y;
+        }
+    }
+    if (norm_a == 0 && norm_e == 0)
+        result.cosine = 1;
+    else if (norm_a == 0 || norm_e == 0)
+        result.cosine = 0;
+    else
+        result.cosine = dot / (std::sqrt(norm_a) * std::sqrt(norm_e));
+    result.max_abs = max_abs;
+    result.rmse = result.count ? std::sqrt(sq_err / result.count) : 0;
+
+    if (topk > 0 && result.count > 0)
+    {
+        std::vector<size_t> ta = topk_indices(va, topk);
+        std::vector<size_t> te = topk_indices(ve, topk);
+        std::vector<size_t> common;
+        std::set_intersection(ta.begin(), ta.end(), te.begin(), te.end(), std::back_inserter(common));
+        result.topk_agreement = (double)common.size() / te.size();
+    }
+    return result;
+}
+
+bool OutputCompare::check(const CompareResult &result, const CompareThreshold &threshold, std::string &reason)
+{
+    char buf[128];
+    reason.clear();
+    if (threshold.cosine_min >= 0 && !(result.cosine >= threshold.cosine_min))
+    {
+        snprintf(buf, sizeof(buf), "cosine %.6f < %.6f; ", result.cosine, threshold.cosine_min);
+        reason += buf;
+    }
+    if (threshold.max_abs_max >= 0 && !(result.max_abs <= threshold.max_abs_max))
+    {
+        snprintf(buf, sizeof(buf), "max_abs %.6g > %.6g; ", result.max_abs, threshold.max_abs_max);
+        reason += buf;
+    }
+    if (threshold.rmse_max >= 0 && !(result.rmse <= threshold.rmse_max))
+    {
+        snprintf(buf, sizeof(buf), "rmse %.6g > %.6g; ", result.rmse, threshold.rmse_max);
+        reason += buf;
+    }
+    if (threshold.topk > 0 && threshold.topk_min >= 0 && !(result.topk_agreement >= threshold.topk_min))
+    {
+        snprintf(buf, sizeof(buf), "top%d agreement %.3f < %.3f; ", threshold.topk, result.topk_agreement, threshold.topk_min);
+        reason += buf;
+    }
+    return reason.empty();
+}
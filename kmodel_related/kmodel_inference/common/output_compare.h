@@ -0,0 +1,127 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _OUTPUT_COMPARE_H
+#define _OUTPUT_COMPARE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief 比较时使用的数据类型，与nncase的typecode一一对应，但不依赖nncase头文件
+ */
+enum TensorDType
+{
+    DT_UINT8 = 0,
+    DT_INT8,
+    DT_UINT16,
+    DT_INT16,
+    DT_UINT32,
+    DT_INT32,
+    DT_UINT64,
+    DT_INT64,
+    DT_FLOAT16,
+    DT_BFLOAT16,
+    DT_FLOAT32,
+    DT_FLOAT64,
+};
+
+/**
+ * @brief 一个输出与期望值的比较结果
+ */
+struct CompareResult
+{
+    size_t count;          // 元素个数
+    bool bit_exact;        // 是否逐字节一致
+    double cosine;         // 余弦相似度（两者都为全0时为1）
+    double max_abs;        // 最大绝对误差
+    double rmse;           // 均方根误差
+    double topk_agreement; // 期望值top-k下标中，实际输出top-k也包含的比例；未计算时为-1
+};
+
+/**
+ * @brief 比较阈值，小于0（topk为0）表示不检查该项
+ */
+struct CompareThreshold
+{
+    CompareThreshold() : cosine_min(-1), max_abs_max(-1), rmse_max(-1), topk(0), topk_min(-1) {}
+
+    double cosine_min;  // 余弦相似度下限
+    double max_abs_max; // 最大绝对误差上限
+    double rmse_max;    // 均方根误差上限
+    int topk;           // 计算top-k一致率时的k
+    double topk_min;    // top-k一致率下限
+};
+
+/**
+ * @brief 按数据类型逐元素比较kmodel输出与期望值（simulator结果等）
+ * 不再把所有输出都当作float：uint8/int16/float16等按各自类型解码成double后计算
+ */
+class OutputCompare
+{
+public:
+    /**
+     * @brief 数据类型的字节数
+     * @param dtype 数据类型
+     * @return 字节数
+     */
+    static size_t dtype_size(TensorDType dtype);
+
+    /**
+     * @brief 数据类型名称转数据类型，名称与nncase一致（uint8、float16、float32等）
+     * @param name  数据类型名称
+     * @param dtype 数据类型
+     * @return 名称合法返回true
+     */
+    static bool parse_dtype(const std::string &name, TensorDType &dtype);
+
+    /**
+     * @brief 数据类型名称
+     * @param dtype 数据类型
+     * @return 名称
+     */
+    static const char *dtype_name(TensorDType dtype);
+
+    /**
+     * @brief 比较两块数据
+     * @param actual   实际输出
+     * @param expected 期望值
+     * @param bytes    字节数（两者相同）
+     * @param dtype    数据类型
+     * @param topk     大于0时计算top-k一致率（对整个展平后的tensor）
+     * @return 比较结果
+     */
+    static CompareResult compare(const void *actual, const void *expected, size_t bytes, TensorDType dtype, int topk = 0);
+
+    /**
+     * @brief 按阈值检查比较结果
+     * @param result    比较结果
+     * @param threshold 阈值
+     * @param reason    不通过时的原因
+     * @return 通过返回true
+     */
+    static bool check(const CompareResult &result, const CompareThreshold &threshold, std::string &reason);
+};
+
+#endif
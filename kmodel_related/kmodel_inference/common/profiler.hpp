@@ -0,0 +1,397 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _PROFILER_HPP
+#define _PROFILER_HPP
+
+#include <string>
+#include <vector>
+#include "timing_label.hpp"
+
+// 编译期开关：-DK230_PROFILER=0时Profiler退化为空实现，ScopedTiming中不留任何采样代码
+#ifndef K230_PROFILER
+#define K230_PROFILER 1
+#endif
+
+#if K230_PROFILER
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#endif
+
+/**
+ * @brief 单个计时节点的统计结果
+ * 节点由(父节点, 计时名称)确定，同名计时出现在不同调用层级下时分别统计
+ */
+struct ProfileStat
+{
+    std::string name;  // 计时对象名称
+    int depth;         // 嵌套层级，0为最外层
+    size_t count;      // 本统计周期内的采样数
+    float min_ms;      // 最小耗时
+    float mean_ms;     // 平均耗时
+    float p50_ms;      // 50分位耗时
+    float p95_ms;      // 95分位耗时
+    float p99_ms;      // 99分位耗时
+};
+
+#if K230_PROFILER
+
+/**
+ * @brief 聚合式性能分析器
+ * ScopedTiming在分析器开启时不再逐条打印，而是把(节点, 耗时)写入本线程的无锁环形缓冲区；
+ * frame()每隔N帧（或程序退出时）由统计线程取走所有线程的采样，按调用层级输出min/mean/p50/p95/p99。
+ * 通过环境变量K230_PROFILE=N开启，N为打印周期（帧数，0表示只在退出时打印）；未开启时ScopedTiming只多一次原子读。
+ */
+class Profiler
+{
+public:
+    /**
+     * @brief 获取全局分析器，首次调用时读取环境变量K230_PROFILE
+     * @return 全局分析器
+     */
+    static Profiler &instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    /**
+     * @brief 分析器是否开启
+     * @return 开启返回true
+     */
+    bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 开启分析器
+     * @param report_every 每隔多少帧打印一次统计，0表示只在退出时打印
+     * @return None
+     */
+    void enable(int report_every)
+    {
+        report_every_ = report_every;
+        enabled_.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 进入一个计时作用域，在当前线程的调用栈上压入对应节点
+     * @param label 计时名称编号（TimingLabel::id）
+     * @return 节点编号
+     */
+    int push(int label)
+    {
+        ThreadState &ts = thread_state();
+        int parent = ts.stack.empty() ? -1 : ts.stack.back();
+        // 先查本线程的缓存，命中时不加锁也不分配内存
+        long long key = ((long long)parent << 32) | (unsigned int)label;
+        auto it = ts.node_cache.find(key);
+        int node = it != ts.node_cache.end() ? it->second : (ts.node_cache[key] = intern(parent, label, (int)ts.stack.size()));
+        ts.stack.push_back(node);
+        return node;
+    }
+
+    /**
+     * @brief 退出计时作用域，记录耗时并弹出节点
+     * @param node       push返回的节点编号
+     * @param elapsed_ms 耗时
+     * @return None
+     */
+    void pop(int node, float elapsed_ms)
+    {
+        ThreadState &ts = thread_state();
+        if (!ts.stack.empty())
+            ts.stack.pop_back();
+        ts.ring->push(node, elapsed_ms);
+    }
+
+    /**
+     * @brief 记录一帧，满report_every帧时打印统计；其它帧把各线程环形缓冲区的采样取到统计数据中，
+     *        只在退出时打印或统计周期很长时环形缓冲区也不会写满丢弃采样
+     * @return None
+     */
+    void frame()
+    {
+        if (!enabled())
+            return;
+        int frames = ++frames_;
+        if (report_every_ > 0 && frames % report_every_ == 0)
+        {
+            report();
+            return;
+        }
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        drain();
+    }
+
+    /**
+     * @brief 取走所有线程的采样并计算本统计周期的结果，随后清空周期数据
+     * @return 按调用层级先序排列的统计结果
+     */
+    std::vector<ProfileStat> collect()
+    {
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        drain();
+
+        std::vector<ProfileStat> stats;
+        std::vector<Node> nodes;
+        {
+            std::lock_guard<std::mutex> nodes_lock(nodes_mutex_);
+            nodes = nodes_;
+        }
+        // 先序遍历，子节点紧跟在父节点之后
+        std::vector<int> order;
+        std::vector<int> stack;
+        for (int i = (int)nodes.size() - 1; i >= 0; i--)
+            if (nodes[i].parent < 0)
+                stack.push_back(i);
+        while (!stack.empty())
+        {
+            int id = stack.back();
+            stack.pop_back();
+            order.push_back(id);
+            for (int i = (int)nodes.size() - 1; i > id; i--)
+                if (nodes[i].parent == id)
+                    stack.push_back(i);
+        }
+
+        for (int id : order)
+        {
+            std::vector<float> &samples = samples_[id];
+            if (samples.empty())
+                continue;
+            std::sort(samples.begin(), samples.end());
+            double sum = 0;
+            for (float v : samples)
+                sum += v;
+            ProfileStat st;
+            st.name = TimingLabel::lookup(nodes[id].label);
+            st.depth = nodes[id].depth;
+            st.count = samples.size();
+            st.min_ms = samples.front();
+            st.mean_ms = (float)(sum / samples.size());
+            st.p50_ms = percentile(samples, 50);
+            st.p95_ms = percentile(samples, 95);
+            st.p99_ms = percentile(samples, 99);
+            stats.push_back(st);
+            samples.clear();
+        }
+        return stats;
+    }
+
+    /**
+     * @brief 打印本统计周期的结果
+     * @return None
+     */
+    void report()
+    {
+        std::vector<ProfileStat> stats = collect();
+        if (stats.empty())
+            return;
+        unsigned long dropped = dropped_.exchange(0);
+        printf("---------------- profiler (frame %d) ----------------\n", frames_.load());
+        printf("%-40s %8s %9s %9s %9s %9s %9s\n", "label (ms)", "count", "min", "mean", "p50", "p95", "p99");
+        for (const ProfileStat &st : stats)
+        {
+            std::string label = std::string(st.depth * 2, ' ') + st.name;
+            printf("%-40s %8zu %9.3f %9.3f %9.3f %9.3f %9.3f\n", label.c_str(), st.count,
+                   st.min_ms, st.mean_ms, st.p50_ms, st.p95_ms, st.p99_ms);
+        }
+        if (dropped)
+            printf("profiler: %lu samples dropped (ring full)\n", dropped);
+        fflush(stdout);
+    }
+
+    ~Profiler()
+    {
+        if (enabled())
+            report();
+    }
+
+private:
+    static const uint32_t ring_size = 4096; // 每个线程环形缓冲区的采样数，需为2的幂
+
+    struct Node
+    {
+        int parent;
+        int depth;
+        int label;
+    };
+
+    struct Sample
+    {
+        int node;
+        float elapsed_ms;
+    };
+
+    /**
+     * @brief 单生产者（计时线程）单消费者（统计线程）的无锁环形缓冲区
+     */
+    struct Ring
+    {
+        Ring(std::atomic<unsigned long> &dropped) : head(0), tail(0), dropped(dropped) {}
+
+        void push(int node, float elapsed_ms)
+        {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) >= ring_size)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            buf[h & (ring_size - 1)] = {node, elapsed_ms};
+            head.store(h + 1, std::memory_order_release);
+        }
+
+        std::atomic<uint32_t> head;
+        std::atomic<uint32_t> tail;
+        std::atomic<unsigned long> &dropped;
+        Sample buf[ring_size];
+    };
+
+    struct ThreadState
+    {
+        std::shared_ptr<Ring> ring;
+        std::vector<int> stack; // 当前线程的计时节点调用栈
+        std::unordered_map<long long, int> node_cache; // (父节点, 名称编号) -> 节点编号
+    };
+
+    Profiler() : enabled_(false), report_every_(0), frames_(0), dropped_(0)
+    {
+        // 析构时report要查名称，名称表需晚于分析器析构
+        TimingLabel::init_registry();
+        const char *env = getenv("K230_PROFILE");
+        if (env)
+            enable(atoi(env));
+    }
+
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    ThreadState &thread_state()
+    {
+        thread_local ThreadState ts;
+        if (!ts.ring)
+        {
+            // 环形缓冲区由分析器持有，线程退出后其中的采样仍能被统计
+            ts.ring = std::make_shared<Ring>(dropped_);
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings_.push_back(ts.ring);
+        }
+        return ts;
+    }
+
+    int intern(int parent, int label, int depth)
+    {
+        std::lock_guard<std::mutex> lock(nodes_mutex_);
+        auto key = std::make_pair(parent, label);
+        auto it = node_ids_.find(key);
+        if (it != node_ids_.end())
+            return it->second;
+        int id = (int)nodes_.size();
+        nodes_.push_back({parent, depth, label});
+        node_ids_.emplace(key, id);
+        return id;
+    }
+
+    void drain()
+    {
+        std::vector<std::shared_ptr<Ring>> rings;
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings = rings_;
+        }
+        for (auto &ring : rings)
+        {
+            uint32_t t = ring->tail.load(std::memory_order_relaxed);
+            uint32_t h = ring->head.load(std::memory_order_acquire);
+            for (; t != h; t++)
+            {
+                const Sample &s = ring->buf[t & (ring_size - 1)];
+                if (s.node >= (int)samples_.size())
+                    samples_.resize(s.node + 1);
+                samples_[s.node].push_back(s.elapsed_ms);
+            }
+            ring->tail.store(t, std::memory_order_release);
+        }
+    }
+
+    static float percentile(const std::vector<float> &sorted, int p)
+    {
+        // nearest-rank
+        size_t rank = (sorted.size() * p + 99) / 100;
+        return sorted[rank ? rank - 1 : 0];
+    }
+
+    std::atomic<bool> enabled_;
+    int report_every_;
+    std::atomic<int> frames_;
+    std::atomic<unsigned long> dropped_;
+
+    std::mutex nodes_mutex_;
+    std::vector<Node> nodes_;
+    std::map<std::pair<int, int>, int> node_ids_;
+
+    std::mutex rings_mutex_;
+    std::vector<std::shared_ptr<Ring>> rings_;
+
+    std::mutex report_mutex_;
+    std::vector<std::vector<float>> samples_; // 统计线程独占，按节点编号索引
+};
+
+#else
+
+/**
+ * @brief K230_PROFILER=0时的空实现，调用处无需条件编译
+ */
+class Profiler
+{
+public:
+    static Profiler &instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+    bool enabled() const { return false; }
+    void enable(int) {}
+    int push(int) { return -1; }
+    void pop(int, float) {}
+    void frame() {}
+    std::vector<ProfileStat> collect() { return {}; }
+    void report() {}
+};
+
+#endif
+
+#endif
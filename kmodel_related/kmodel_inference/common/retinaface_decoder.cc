@@ -0,0 +1,152 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "retinaface_decoder.h"
+#include "fast_exp.hpp"
+
+RetinaFaceDecoder::RetinaFaceDecoder(ScoreMode score_mode, bool fast_exp) : score_mode_(score_mode), fast_exp_(fast_exp)
+{
+}
+
+std::unique_ptr<RetinaFaceDecoder> RetinaFaceDecoder::create(int input_size, ScoreMode score_mode, bool fast_exp)
+{
+    switch (input_size)
+    {
+    case 640:
+        return std::unique_ptr<RetinaFaceDecoder>(new FixedRetinaFaceDecoder<640>(score_mode, fast_exp));
+    default:
+        return std::unique_ptr<RetinaFaceDecoder>(new GenericRetinaFaceDecoder(input_size, score_mode, fast_exp));
+    }
+}
+
+std::unique_ptr<RetinaFaceDecoder> RetinaFaceDecoder::from_env(int input_size)
+{
+    ScoreMode score_mode = SCORE_PROBABILITY;
+    const char *env = getenv("K230_DET_SCORE");
+    if (env)
+    {
+        if (strcmp(env, "sigmoid") == 0)
+            score_mode = SCORE_SIGMOID_LOGIT;
+        else if (strcmp(env, "softmax") == 0)
+            score_mode = SCORE_SOFTMAX_LOGITS;
+        else if (strcmp(env, "prob") != 0)
+            std::cerr << "K230_DET_SCORE=" << env << " not recognized (prob, sigmoid, softmax), using prob" << std::endl;
+    }
+    env = getenv("K230_FAST_EXP");
+    bool fast_exp = env && strcmp(env, "0") != 0;
+    return create(input_size, score_mode, fast_exp);
+}
+
+float RetinaFaceDecoder::score_threshold(ScoreMode score_mode, float thresh)
+{
+    if (score_mode == SCORE_PROBABILITY)
+        return thresh;
+    // sigmoid单调，p > t等价于logit > ln(t / (1 - t))
+    if (thresh <= 0.f)
+        return -INFINITY;
+    if (thresh >= 1.f)
+        return INFINITY;
+    return std::log(thresh / (1.f - thresh));
+}
+
+void RetinaFaceDecoder::finish(size_t first, vector<FaceDetectionInfo> &results)
+{
+    int n = (int)exp_args_.size();
+    float *e = exp_args_.data();
+    if (fast_exp_)
+    {
+        ::fast_exp(e, e, n);
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+            e[i] = std::exp(e[i]);
+    }
+
+    bool logit = score_mode_ != SCORE_PROBABILITY;
+    for (size_t i = first; i < results.size(); i++, e += 3)
+    {
+        Bbox &b = results[i].bbox;
+        // push时bbox.x/y为框中心，w/h为anchor宽高
+        b.w *= e[0];
+        b.h *= e[1];
+        b.x -= b.w * 0.5f;
+        b.y -= b.h * 0.5f;
+        if (logit)
+            results[i].score = 1.f / (1.f + e[2]);
+    }
+    exp_args_.clear();
+}
+
+GenericRetinaFaceDecoder::GenericRetinaFaceDecoder(int input_size, ScoreMode score_mode, bool fast_exp) : RetinaFaceDecoder(score_mode, fast_exp)
+{
+    static const int steps[] = {8, 16, 32};
+    static const int min_sizes[][2] = {{16, 32}, {64, 128}, {256, 512}};
+    anchors_.reserve(RetinaFaceDecoder::anchors_num(input_size));
+    for (int level = 0; level < 3; level++)
+    {
+        int feature = input_size / steps[level];
+        float step = (float)steps[level] / input_size;
+        for (int i = 0; i < feature; i++)
+        {
+            for (int j = 0; j < feature; j++)
+            {
+                for (int k = 0; k < 2; k++)
+                {
+                    float size = (float)min_sizes[level][k] / input_size;
+                    anchors_.push_back({(j + 0.5f) * step, (i + 0.5f) * step, size, size});
+                }
+            }
+        }
+    }
+}
+
+void GenericRetinaFaceDecoder::decode(const float *loc, const float *conf, const float *landms, float thresh, vector<FaceDetectionInfo> &results)
+{
+    size_t first = results.size();
+    float key_thresh = score_threshold(score_mode_, thresh);
+    for (size_t index = 0; index < anchors_.size(); index++)
+    {
+        const float *c = conf + index * CONF_SIZE;
+        float key = score_mode_ == SCORE_SOFTMAX_LOGITS ? score_key<SCORE_SOFTMAX_LOGITS, CONF_SIZE>(c) : score_key<SCORE_PROBABILITY, CONF_SIZE>(c);
+        if (key <= key_thresh)
+            continue;
+        const array<float, 4> &anchor = anchors_[index];
+        push(loc + index * LOC_SIZE, landms + index * LAND_SIZE, anchor[0], anchor[1], anchor[2], key, results);
+    }
+    finish(first, results);
+}
+
+int GenericRetinaFaceDecoder::anchors_num() const
+{
+    return (int)anchors_.size();
+}
+
+const vector<array<float, 4>> &GenericRetinaFaceDecoder::anchors() const
+{
+    return anchors_;
+}
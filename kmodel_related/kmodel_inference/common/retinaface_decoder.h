@@ -0,0 +1,298 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _RETINAFACE_DECODER_H
+#define _RETINAFACE_DECODER_H
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "face_detection.h"
+
+/**
+ * @brief 置信度输出的含义
+ */
+enum ScoreMode
+{
+    SCORE_PROBABILITY,    // 模型内已做softmax，最后一个通道为人脸概率
+    SCORE_SIGMOID_LOGIT,  // 最后一个通道为人脸logit，概率为sigmoid(logit)
+    SCORE_SOFTMAX_LOGITS, // 两个通道为背景、人脸的logit，概率为softmax，即sigmoid(人脸logit - 背景logit)
+};
+
+/**
+ * @brief RetinaFace输出解码
+ * 一次遍历所有anchor：置信度超过阈值的anchor解码出检测框和五官点（只用float运算），供排序和nms使用；
+ * 输出为logit时阈值先换算到logit域，被拒绝的anchor不做sigmoid/softmax，只有保留的anchor换算成概率；
+ * 保留的anchor先记下exp的参数，遍历结束后对连续数组统一计算exp（可选fast_exp，可向量化）。
+ * anchor按RetinaFace的规则生成：stride 8/16/32三层特征图，每个格子2个anchor（min size 16,32 / 64,128 / 256,512），
+ * 顺序为层、行、列、min size，中心为格子中心，宽高为min size，均按输入边长归一化
+ */
+class RetinaFaceDecoder
+{
+public:
+    /**
+     * @brief RetinaFaceDecoder构造函数
+     * @param score_mode  置信度输出的含义
+     * @param fast_exp    是否用fast_exp（相对误差不超过FAST_EXP_MAX_REL_ERROR）代替std::exp
+     * @return None
+     */
+    RetinaFaceDecoder(ScoreMode score_mode, bool fast_exp);
+
+    virtual ~RetinaFaceDecoder() {}
+
+    /**
+     * @brief 解码置信度超过阈值的anchor
+     * @param loc      检测框输出，每个anchor LOC_SIZE个值
+     * @param conf     置信度输出，每个anchor CONF_SIZE个值，含义见ScoreMode
+     * @param landms   五官点输出，每个anchor LAND_SIZE个值
+     * @param thresh   概率阈值，大于阈值的anchor被保留
+     * @param results  解码结果（追加），坐标按输入边长归一化，bbox.x/y为左上角，score为概率
+     * @return None
+     */
+    virtual void decode(const float *loc, const float *conf, const float *landms, float thresh, vector<FaceDetectionInfo> &results) = 0;
+
+    /**
+     * @brief anchor个数，应与模型输出的roi个数一致
+     * @return anchor个数
+     */
+    virtual int anchors_num() const = 0;
+
+    ScoreMode score_mode() const { return score_mode_; }
+    bool use_fast_exp() const { return fast_exp_; }
+
+    /**
+     * @brief 按模型输入边长创建解码器：640使用编译期展开的FixedRetinaFaceDecoder，
+     *        其它边长使用GenericRetinaFaceDecoder（320的anchor少，特化与通用解码耗时相当，不值得多一份展开的代码）
+     * @param input_size  模型输入边长（输入为正方形）
+     * @param score_mode  置信度输出的含义
+     * @param fast_exp    是否用fast_exp代替std::exp
+     * @return 解码器
+     */
+    static std::unique_ptr<RetinaFaceDecoder> create(int input_size, ScoreMode score_mode = SCORE_PROBABILITY, bool fast_exp = false);
+
+    /**
+     * @brief 按环境变量创建解码器：K230_DET_SCORE=prob|sigmoid|softmax指定置信度输出的含义（默认prob），
+     *        K230_FAST_EXP=1时用fast_exp；取值无法识别时提示并使用默认值
+     * @param input_size  模型输入边长（输入为正方形）
+     * @return 解码器
+     */
+    static std::unique_ptr<RetinaFaceDecoder> from_env(int input_size);
+
+    /**
+     * @brief 按输入边长计算anchor个数
+     * @param input_size  模型输入边长
+     * @return anchor个数
+     */
+    static constexpr int anchors_num(int input_size)
+    {
+        return 2 * ((input_size / 8) * (input_size / 8) + (input_size / 16) * (input_size / 16) + (input_size / 32) * (input_size / 32));
+    }
+
+    /**
+     * @brief 把概率阈值换算到比较用的分数域：概率模式不变，logit模式为ln(t / (1 - t))
+     * @param score_mode  置信度输出的含义
+     * @param thresh      概率阈值
+     * @return 分数域的阈值
+     */
+    static float score_threshold(ScoreMode score_mode, float thresh);
+
+    /**
+     * @brief 一个anchor用于和阈值比较的分数，logit模式下不做sigmoid/softmax
+     * @tparam Mode      置信度输出的含义
+     * @tparam ConfSize  每个anchor的置信度输出个数
+     * @param conf       该anchor的置信度输出
+     * @return 分数
+     */
+    template <ScoreMode Mode, int ConfSize>
+    static inline float score_key(const float *conf)
+    {
+        return Mode == SCORE_SOFTMAX_LOGITS ? conf[ConfSize - 1] - conf[0] : conf[ConfSize - 1];
+    }
+
+protected:
+    /**
+     * @brief 记下一个保留的anchor：五官点和框中心直接解码，宽高和概率需要的exp留到finish统一计算
+     * @param loc      该anchor的检测框输出
+     * @param landm    该anchor的五官点输出
+     * @param cx       anchor中心x
+     * @param cy       anchor中心y
+     * @param size     anchor宽高
+     * @param key      分数（见score_key）
+     * @param results  解码结果
+     * @return None
+     */
+    inline void push(const float *loc, const float *landm, float cx, float cy, float size, float key, vector<FaceDetectionInfo> &results)
+    {
+        float scale = 0.1f * size;
+        results.emplace_back();
+        FaceDetectionInfo &info = results.back();
+        info.bbox.x = cx + loc[0] * scale;
+        info.bbox.y = cy + loc[1] * scale;
+        info.bbox.w = size;
+        info.bbox.h = size;
+        for (int k = 0; k < LAND_SIZE / 2; k++)
+        {
+            info.sparse_kps.points[2 * k] = cx + landm[2 * k] * scale;
+            info.sparse_kps.points[2 * k + 1] = cy + landm[2 * k + 1] * scale;
+        }
+        info.score = key;
+        exp_args_.push_back(loc[2] * 0.2f);
+        exp_args_.push_back(loc[3] * 0.2f);
+        exp_args_.push_back(-key);
+    }
+
+    /**
+     * @brief 对push记下的exp参数统一计算exp，得到宽高、左上角和概率
+     * @param first    本次decode第一个结果在results中的位置
+     * @param results  解码结果
+     * @return None
+     */
+    void finish(size_t first, vector<FaceDetectionInfo> &results);
+
+    ScoreMode score_mode_;      // 置信度输出的含义
+    bool fast_exp_;             // 是否用fast_exp
+    vector<float> exp_args_;    // 每个保留的anchor 3个exp参数：宽、高、-分数，计算后原地替换为结果
+};
+
+/**
+ * @brief 编译期特化的解码器：输入边长、输出布局为模板参数，anchor由循环下标和编译期常数算出，不查anchor表；
+ *        每层的特征图大小、stride、min size都是常数，每个格子的2个anchor展开处理
+ * @tparam InputSize  模型输入边长，需为32的倍数
+ * @tparam LocSize    每个anchor的检测框输出个数（>=4）
+ * @tparam ConfSize   每个anchor的置信度输出个数，最后一个为人脸
+ * @tparam LandSize   每个anchor的五官点输出个数（>=LAND_SIZE）
+ */
+template <int InputSize, int LocSize = LOC_SIZE, int ConfSize = CONF_SIZE, int LandSize = LAND_SIZE>
+class FixedRetinaFaceDecoder : public RetinaFaceDecoder
+{
+    static_assert(InputSize > 0 && InputSize % 32 == 0, "input size must be a multiple of 32");
+    static_assert(LocSize >= 4 && ConfSize >= 1 && LandSize >= LAND_SIZE, "unsupported head layout");
+
+public:
+    static constexpr int kAnchorsNum = RetinaFaceDecoder::anchors_num(InputSize);
+
+    explicit FixedRetinaFaceDecoder(ScoreMode score_mode = SCORE_PROBABILITY, bool fast_exp = false) : RetinaFaceDecoder(score_mode, fast_exp)
+    {
+    }
+
+    void decode(const float *loc, const float *conf, const float *landms, float thresh, vector<FaceDetectionInfo> &results) override
+    {
+        size_t first = results.size();
+        float key_thresh = score_threshold(score_mode_, thresh);
+        // 分数的算法按模式特化，判断不在逐anchor的循环里
+        switch (score_mode_)
+        {
+        case SCORE_PROBABILITY:
+            scan<SCORE_PROBABILITY>(loc, conf, landms, key_thresh, results);
+            break;
+        case SCORE_SIGMOID_LOGIT:
+            scan<SCORE_SIGMOID_LOGIT>(loc, conf, landms, key_thresh, results);
+            break;
+        case SCORE_SOFTMAX_LOGITS:
+            scan<SCORE_SOFTMAX_LOGITS>(loc, conf, landms, key_thresh, results);
+            break;
+        }
+        finish(first, results);
+    }
+
+    int anchors_num() const override
+    {
+        return kAnchorsNum;
+    }
+
+private:
+    template <ScoreMode Mode>
+    void scan(const float *loc, const float *conf, const float *landms, float key_thresh, vector<FaceDetectionInfo> &results)
+    {
+        int index = 0;
+        scan_level<Mode, 8, 16, 32>(loc, conf, landms, key_thresh, index, results);
+        scan_level<Mode, 16, 64, 128>(loc, conf, landms, key_thresh, index, results);
+        scan_level<Mode, 32, 256, 512>(loc, conf, landms, key_thresh, index, results);
+    }
+
+    template <ScoreMode Mode, int Step, int MinSize0, int MinSize1>
+    void scan_level(const float *loc, const float *conf, const float *landms, float key_thresh, int &index, vector<FaceDetectionInfo> &results)
+    {
+        constexpr int kFeature = InputSize / Step;
+        constexpr float kStep = (float)Step / InputSize;
+        constexpr float kSize0 = (float)MinSize0 / InputSize;
+        constexpr float kSize1 = (float)MinSize1 / InputSize;
+        for (int i = 0; i < kFeature; i++)
+        {
+            // 先无分支地检查这一行的2*kFeature个anchor（可向量化），绝大多数行没有超过阈值的anchor，直接跳过
+            const float *row = conf + index * ConfSize;
+            int any = 0;
+            for (int a = 0; a < 2 * kFeature; a++)
+                any |= score_key<Mode, ConfSize>(row + a * ConfSize) > key_thresh;
+            if (!any)
+            {
+                index += 2 * kFeature;
+                continue;
+            }
+            float cy = (i + 0.5f) * kStep;
+            for (int j = 0; j < kFeature; j++, index += 2)
+            {
+                float cx = (j + 0.5f) * kStep;
+                float key0 = score_key<Mode, ConfSize>(conf + index * ConfSize);
+                float key1 = score_key<Mode, ConfSize>(conf + (index + 1) * ConfSize);
+                if (key0 > key_thresh)
+                    push(loc + index * LocSize, landms + index * LandSize, cx, cy, kSize0, key0, results);
+                if (key1 > key_thresh)
+                    push(loc + (index + 1) * LocSize, landms + (index + 1) * LandSize, cx, cy, kSize1, key1, results);
+            }
+        }
+    }
+};
+
+/**
+ * @brief 通用解码器：任意输入边长（32的倍数），构造时生成anchor表，解码时查表
+ */
+class GenericRetinaFaceDecoder : public RetinaFaceDecoder
+{
+public:
+    /**
+     * @brief GenericRetinaFaceDecoder构造函数
+     * @param input_size  模型输入边长
+     * @param score_mode  置信度输出的含义
+     * @param fast_exp    是否用fast_exp代替std::exp
+     * @return None
+     */
+    explicit GenericRetinaFaceDecoder(int input_size, ScoreMode score_mode = SCORE_PROBABILITY, bool fast_exp = false);
+
+    void decode(const float *loc, const float *conf, const float *landms, float thresh, vector<FaceDetectionInfo> &results) override;
+
+    int anchors_num() const override;
+
+    /**
+     * @brief 生成的anchor表
+     * @return 每个anchor为{cx, cy, w, h}
+     */
+    const vector<array<float, 4>> &anchors() const;
+
+private:
+    vector<array<float, 4>> anchors_; // anchor表
+};
+
+#endif
@@ -0,0 +1,141 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _SCOPED_TIMING_HPP
+#define _SCOPED_TIMING_HPP
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <iostream>
+#include "timing_label.hpp"
+#include "profiler.hpp"
+#include "trace_recorder.hpp"
+
+/**
+ * @brief 计时类
+ * 统计在该类实例生命周期内的耗时
+ * Profiler开启时（K230_PROFILE=N），不论enable_profile取值都计时，耗时交给Profiler聚合，不再逐条打印
+ * TraceRecorder开启时（K230_TRACE_FILE=xxx.json），实例的生命周期同时记为所在线程时间线上的一个区间
+ * 设置了观察者（如Metrics）时，每个实例结束时把(名称编号, 耗时)交给观察者
+ * 热路径上请传入预先构造的TimingLabel，构造和析构都不分配内存；传std::string的版本用于一次性的临时名称
+ */
+class ScopedTiming
+{
+public:
+	typedef void (*Observer)(int label, float elapsed_ms);
+
+	/**
+	 * @brief ScopedTiming构造函数,使用预先登记的计时名称并开始计时
+	 * @param label 		 计时名称，需在ScopedTiming的生命周期内有效
+	 * @param enable_profile 是否开始计时
+	 * @return None
+	 */
+	ScopedTiming(const TimingLabel &label, int enable_profile = 1)
+		: enable_profile(enable_profile), m_name(&label.name()), m_label(label.id()), m_node(-1), m_trace(false), m_observer(nullptr)
+	{
+		start();
+	}
+
+	/**
+	 * @brief ScopedTiming构造函数,初始化计时对象名称并开始计时
+	 * @param info 			 计时对象名称
+	 * @param enable_profile 是否开始计时
+	 * @return None
+	 */
+	ScopedTiming(std::string info = "ScopedTiming", int enable_profile = 1)
+		: enable_profile(enable_profile), m_info(info), m_name(&m_info), m_label(-1), m_node(-1), m_trace(false), m_observer(nullptr)
+	{
+		// 临时名称只在Profiler/TraceRecorder/观察者需要编号时才登记
+		if (Profiler::instance().enabled() || TraceRecorder::instance().enabled() || observer_slot().load(std::memory_order_relaxed))
+			m_label = TimingLabel::intern(m_info);
+		start();
+	}
+
+	ScopedTiming(const ScopedTiming &) = delete;
+	ScopedTiming &operator=(const ScopedTiming &) = delete;
+
+	/**
+	 * @brief ScopedTiming析构,结束计时，并打印耗时
+	 * @return None
+	 */
+	~ScopedTiming()
+	{
+		if (m_trace)
+			TraceRecorder::instance().end(m_label);
+		if (m_node < 0 && !m_observer && !enable_profile)
+			return;
+		m_stop = std::chrono::steady_clock::now();
+		double elapsed_ms = std::chrono::duration<double, std::milli>(m_stop - m_start).count();
+		if (m_observer)
+			m_observer(m_label, (float)elapsed_ms);
+		if (m_node >= 0)
+			Profiler::instance().pop(m_node, (float)elapsed_ms);
+		else if (enable_profile)
+			std::cout << *m_name << " took " << elapsed_ms << " ms" << std::endl;
+	}
+
+	/**
+	 * @brief 设置耗时观察者，之后构造的ScopedTiming结束时回调
+	 * @param observer 观察者，nullptr表示取消
+	 * @return None
+	 */
+	static void set_observer(Observer observer)
+	{
+		observer_slot().store(observer, std::memory_order_relaxed);
+	}
+
+private:
+	static std::atomic<Observer> &observer_slot()
+	{
+		static std::atomic<Observer> observer(nullptr);
+		return observer;
+	}
+
+	void start()
+	{
+		m_observer = observer_slot().load(std::memory_order_relaxed);
+		m_trace = TraceRecorder::instance().enabled();
+		if (m_trace)
+			TraceRecorder::instance().begin(m_label);
+		if (Profiler::instance().enabled())
+			m_node = Profiler::instance().push(m_label);
+		if (enable_profile || m_node >= 0 || m_observer)
+		{
+			m_start = std::chrono::steady_clock::now();
+		}
+	}
+
+	int enable_profile;							   // 是否统计时间
+	std::string m_info;							   // 临时计时对象名称（传std::string构造时）
+	const std::string *m_name;					   // 计时对象名称
+	int m_label;								   // 计时名称编号，临时名称未登记时为-1
+	int m_node;									   // Profiler中的节点编号，未开启时为-1
+	bool m_trace;								   // 是否记录到TraceRecorder
+	Observer m_observer;						   // 构造时的耗时观察者
+	std::chrono::steady_clock::time_point m_start; // 计时开始时间
+	std::chrono::steady_clock::time_point m_stop;  // 计时结束时间
+};
+
+#endif
\ No newline at end of file
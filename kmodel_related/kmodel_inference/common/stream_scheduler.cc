@@ -0,0 +1,93 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "stream_scheduler.h"
+
+StreamScheduler::StreamScheduler() : last_(-1)
+{
+}
+
+int StreamScheduler::add(float weight)
+{
+    // 中途加入的流从当前最小虚拟时间开始，不补偿之前的调度
+    entries_.push_back({weight > 0 ? weight : 1.f, min_vtime(), true, 0});
+    return (int)entries_.size() - 1;
+}
+
+void StreamScheduler::set_enabled(int index, bool enabled)
+{
+    Entry &e = entries_[index];
+    if (enabled && !e.enabled)
+    {
+        double vtime = min_vtime();
+        if (e.vtime < vtime)
+            e.vtime = vtime;
+    }
+    e.enabled = enabled;
+}
+
+int StreamScheduler::next()
+{
+    int n = (int)entries_.size();
+    int best = -1;
+    for (int k = 1; k <= n; k++)
+    {
+        int i = (last_ + k) % n;
+        const Entry &e = entries_[i];
+        if (e.enabled && (best < 0 || e.vtime < entries_[best].vtime))
+            best = i;
+    }
+    if (best < 0)
+        return -1;
+
+    entries_[best].vtime += 1.0 / entries_[best].weight;
+    entries_[best].count++;
+    last_ = best;
+    return best;
+}
+
+uint64_t StreamScheduler::count(int index) const
+{
+    return entries_[index].count;
+}
+
+int StreamScheduler::size() const
+{
+    return (int)entries_.size();
+}
+
+double StreamScheduler::min_vtime() const
+{
+    bool found = false;
+    double vtime = 0;
+    for (const Entry &e : entries_)
+    {
+        if (e.enabled && (!found || e.vtime < vtime))
+        {
+            vtime = e.vtime;
+            found = true;
+        }
+    }
+    return vtime;
+}
@@ -0,0 +1,90 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _STREAM_SCHEDULER_H
+#define _STREAM_SCHEDULER_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 多路流共用模型时的公平调度（加权虚拟时间）
+ * 每路流有一个虚拟时间，被调度一次增加1/weight；每次选虚拟时间最小的流，相同时从上次调度的下一路开始轮询。
+ * 权重相同的流轮流推理，权重为2的流得到两倍的推理次数；采集失败的一次调度同样计入，掉线的摄像头不会占满推理
+ */
+class StreamScheduler
+{
+public:
+    StreamScheduler();
+
+    /**
+     * @brief 添加一路流
+     * @param weight 权重（>0）
+     * @return 流序号，从0开始
+     */
+    int add(float weight = 1.f);
+
+    /**
+     * @brief 启用/停用一路流，停用的流不参与调度；重新启用时虚拟时间追平其它流，不会连续补偿
+     * @param index   流序号
+     * @param enabled 是否启用
+     * @return None
+     */
+    void set_enabled(int index, bool enabled);
+
+    /**
+     * @brief 选出下一路要推理的流，并计入一次调度
+     * @return 流序号，没有启用的流时返回-1
+     */
+    int next();
+
+    /**
+     * @brief 一路流被调度的次数
+     * @param index 流序号
+     * @return 次数
+     */
+    uint64_t count(int index) const;
+
+    int size() const;
+
+private:
+    /**
+     * @brief 启用的流中最小的虚拟时间
+     * @return 虚拟时间，没有启用的流时返回0
+     */
+    double min_vtime() const;
+
+    typedef struct Entry
+    {
+        float weight;     // 权重
+        double vtime;     // 虚拟时间
+        bool enabled;     // 是否参与调度
+        uint64_t count;   // 被调度次数
+    } Entry;
+
+    std::vector<Entry> entries_; // 各路流
+    int last_;                   // 上次调度的流
+};
+
+#endif
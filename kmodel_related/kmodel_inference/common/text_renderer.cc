@@ -0,0 +1,136 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <cmath>
+#include <cstring>
+#include <opencv2/imgproc.hpp>
+#include "text_renderer.h"
+
+#define GLYPH_FIRST (' ')
+#define GLYPH_LAST ('~')
+#define ADVANCE_REPEAT (100)
+
+const TextRenderer::GlyphTable &TextRenderer::get_table(int font_face, double font_scale, int thickness)
+{
+    StyleKey key(font_face, (int)lround(font_scale * 1000), thickness);
+    auto it = tables_.find(key);
+    if (it != tables_.end())
+        return it->second;
+
+    GlyphTable table(GLYPH_LAST - GLYPH_FIRST + 1);
+    for (int c = GLYPH_FIRST; c <= GLYPH_LAST; ++c)
+    {
+        Glyph &g = table[c - GLYPH_FIRST];
+        std::string s(1, (char)c);
+        int baseline = 0;
+        cv::Size size = cv::getTextSize(s, font_face, font_scale, thickness, &baseline);
+
+        // 字符宽度为小数，用重复字符串测量以减小取整误差
+        cv::Size repeat_size = cv::getTextSize(std::string(ADVANCE_REPEAT, (char)c), font_face, font_scale, thickness, nullptr);
+        g.advance = (float)(repeat_size.width - thickness) / ADVANCE_REPEAT;
+
+        // 在留足边距的画布上光栅化，再裁出非零区域
+        int margin = thickness + 4;
+        cv::Mat canvas(size.height + baseline + 2 * margin, size.width + 2 * margin, CV_8UC1, cv::Scalar(0));
+        cv::Point origin(margin, margin + size.height);
+        cv::putText(canvas, s, origin, font_face, font_scale, cv::Scalar(255), thickness, cv::LINE_8, false);
+
+        int x0 = canvas.cols, y0 = canvas.rows, x1 = -1, y1 = -1;
+        for (int y = 0; y < canvas.rows; ++y)
+        {
+            const uint8_t *row = canvas.ptr<uint8_t>(y);
+            for (int x = 0; x < canvas.cols; ++x)
+            {
+                if (row[x])
+                {
+                    x0 = std::min(x0, x);
+                    x1 = std::max(x1, x);
+                    y0 = std::min(y0, y);
+                    y1 = std::max(y1, y);
+                }
+            }
+        }
+        if (x1 < 0)
+        {
+            // 空格等不可见字符
+            g.width = g.height = g.offset_x = g.offset_y = 0;
+            continue;
+        }
+
+        g.width = x1 - x0 + 1;
+        g.height = y1 - y0 + 1;
+        g.offset_x = x0 - origin.x;
+        g.offset_y = y0 - origin.y;
+        g.alpha.resize(g.width * g.height);
+        for (int y = 0; y < g.height; ++y)
+            memcpy(&g.alpha[y * g.width], canvas.ptr<uint8_t>(y0 + y) + x0, g.width);
+    }
+    return tables_.emplace(key, std::move(table)).first->second;
+}
+
+cv::Rect TextRenderer::draw(cv::Mat &img, const std::string &text, const cv::Point &org, int font_face, double font_scale, const cv::Scalar &color, int thickness)
+{
+    const GlyphTable &table = get_table(font_face, font_scale, thickness);
+    uint8_t bgra[4] = {(uint8_t)color[0], (uint8_t)color[1], (uint8_t)color[2], (uint8_t)color[3]};
+    uint32_t pixel;
+    memcpy(&pixel, bgra, sizeof(pixel));
+
+    cv::Rect touched;
+    float pen_x = org.x;
+    for (unsigned char c : text)
+    {
+        if (c < GLYPH_FIRST || c > GLYPH_LAST)
+            c = '?';
+        const Glyph &g = table[c - GLYPH_FIRST];
+        int gx = (int)lroundf(pen_x) + g.offset_x;
+        int gy = org.y + g.offset_y;
+        pen_x += g.advance;
+        if (g.width == 0)
+            continue;
+        touched = touched | cv::Rect(gx, gy, g.width, g.height);
+
+        // 裁剪到图像范围
+        int sx = std::max(0, -gx), sy = std::max(0, -gy);
+        int ex = std::min(g.width, img.cols - gx), ey = std::min(g.height, img.rows - gy);
+        for (int y = sy; y < ey; ++y)
+        {
+            const uint8_t *a = &g.alpha[y * g.width];
+            uint32_t *dst = img.ptr<uint32_t>(gy + y) + gx;
+            for (int x = sx; x < ex; ++x)
+            {
+                if (a[x] == 0)
+                    continue;
+                if (a[x] == 255)
+                {
+                    dst[x] = pixel;
+                    continue;
+                }
+                uint8_t *d = reinterpret_cast<uint8_t *>(&dst[x]);
+                for (int ch = 0; ch < 4; ++ch)
+                    d[ch] = (uint8_t)((bgra[ch] * a[x] + d[ch] * (255 - a[x]) + 127) / 255);
+            }
+        }
+    }
+    return touched;
+}
@@ -0,0 +1,77 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _TEXT_RENDERER_H
+#define _TEXT_RENDERER_H
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <opencv2/core.hpp>
+
+/**
+ * @brief 单个字符的光栅化结果
+ */
+typedef struct Glyph
+{
+    int width;                  // 字形宽
+    int height;                 // 字形高
+    int offset_x;               // 字形左上角相对笔位置（基线）的x偏移
+    int offset_y;               // 字形左上角相对笔位置（基线）的y偏移
+    float advance;              // 笔位置前进量
+    std::vector<uint8_t> alpha; // 覆盖度（0~255），width*height
+} Glyph;
+
+/**
+ * @brief 基于字形缓存的文字绘制
+ * 每种（字体、缩放、线宽）第一次使用时用cv::putText把可打印ASCII字符光栅化成字形表，
+ * 之后每次绘制只按覆盖度把字形混合到ARGB8888（CV_8UC4）图像中，不再每次由笔画重新光栅化
+ */
+class TextRenderer
+{
+public:
+    /**
+     * @brief 绘制文字，参数含义与cv::putText一致
+     * @param img        目标图像（CV_8UC4，B,G,R,A）
+     * @param text       文字，不在字形表中的字符按'?'绘制
+     * @param org        文字左下角
+     * @param font_face  字体
+     * @param font_scale 字体缩放
+     * @param color      颜色（B,G,R,A）
+     * @param thickness  线宽
+     * @return 实际写过的区域（未裁剪）
+     */
+    cv::Rect draw(cv::Mat &img, const std::string &text, const cv::Point &org, int font_face, double font_scale, const cv::Scalar &color, int thickness);
+
+private:
+    typedef std::tuple<int, int, int> StyleKey;          // 字体、缩放*1000、线宽
+    typedef std::vector<Glyph> GlyphTable;               // 下标为字符-' '
+
+    const GlyphTable &get_table(int font_face, double font_scale, int thickness);
+
+    std::map<StyleKey, GlyphTable> tables_;              // 各字体样式的字形表
+};
+
+#endif
@@ -0,0 +1,126 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _TIMING_LABEL_HPP
+#define _TIMING_LABEL_HPP
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief 计时名称，构造时在全局表中登记一次，之后按编号使用
+ * 热路径上的ScopedTiming传入预先构造好的TimingLabel，不再每次拼接std::string；
+ * Profiler、TraceRecorder也只记录编号，输出时再查名称。同名的TimingLabel编号相同。
+ */
+class TimingLabel
+{
+public:
+    /**
+     * @brief TimingLabel构造函数，登记计时名称
+     * @param name 计时名称
+     * @return None
+     */
+    explicit TimingLabel(const std::string &name) : id_(intern(name)), name_(&lookup(id_))
+    {
+    }
+
+    /**
+     * @brief 名称编号
+     * @return 编号，从0开始连续分配
+     */
+    int id() const
+    {
+        return id_;
+    }
+
+    /**
+     * @brief 名称
+     * @return 登记的名称，地址在程序运行期间不变
+     */
+    const std::string &name() const
+    {
+        return *name_;
+    }
+
+    /**
+     * @brief 登记名称，已登记过的直接返回原编号
+     * @param name 计时名称
+     * @return 名称编号
+     */
+    static int intern(const std::string &name)
+    {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        auto it = r.ids.find(name);
+        if (it != r.ids.end())
+            return it->second;
+        int id = (int)r.names.size();
+        r.names.push_back(name);
+        r.ids.emplace(name, id);
+        return id;
+    }
+
+    /**
+     * @brief 按编号查名称
+     * @param id 名称编号
+     * @return 登记的名称
+     */
+    static const std::string &lookup(int id)
+    {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        return r.names[id];
+    }
+
+    /**
+     * @brief 构造全局表：退出时还要查名称的单例（Profiler、TraceRecorder）在构造函数中调用，
+     *        使全局表先于它们构造、晚于它们析构
+     * @return None
+     */
+    static void init_registry()
+    {
+        registry();
+    }
+
+private:
+    struct Registry
+    {
+        std::mutex mutex;
+        std::deque<std::string> names; // deque尾部追加不会移动已有元素，返回的引用一直有效
+        std::unordered_map<std::string, int> ids;
+    };
+
+    static Registry &registry()
+    {
+        static Registry r;
+        return r;
+    }
+
+    int id_;                  // 名称编号
+    const std::string *name_; // 名称
+};
+
+#endif
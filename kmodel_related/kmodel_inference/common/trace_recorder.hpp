@@ -0,0 +1,321 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _TRACE_RECORDER_HPP
+#define _TRACE_RECORDER_HPP
+
+#include <string>
+#include "timing_label.hpp"
+
+#ifndef K230_PROFILER
+#define K230_PROFILER 1
+#endif
+
+#if K230_PROFILER
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif
+
+#if K230_PROFILER
+
+/**
+ * @brief 时间线记录器，输出Chrome Trace Event格式的json（chrome://tracing、ui.perfetto.dev可直接打开）
+ * 通过环境变量K230_TRACE_FILE=xxx.json开启：ScopedTiming的构造/析构分别记为所在线程的B/E事件，
+ * flow_begin/flow_step/flow_end按帧号在采集、推理、osd等线程之间连出帧的流向箭头；程序退出时写文件。
+ * 每个线程最多缓存K230_TRACE_MAX_EVENTS（默认200000）个事件，超出的丢弃。
+ */
+class TraceRecorder
+{
+public:
+    /**
+     * @brief 获取全局记录器，首次调用时读取环境变量
+     * @return 全局记录器
+     */
+    static TraceRecorder &instance()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    /**
+     * @brief 记录器是否开启
+     * @return 开启返回true
+     */
+    bool enabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 开启记录器
+     * @param file 输出的json文件
+     * @return None
+     */
+    void enable(const std::string &file)
+    {
+        file_ = file;
+        enabled_.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 设置当前线程在时间线上显示的名称
+     * @param name 线程名称
+     * @return None
+     */
+    void set_thread_name(const std::string &name)
+    {
+        if (!enabled())
+            return;
+        ThreadBuffer &tb = thread_buffer();
+        std::lock_guard<std::mutex> lock(tb.mutex);
+        tb.name = name;
+    }
+
+    /**
+     * @brief 当前线程进入一个区间
+     * @param label 区间名称编号（TimingLabel::id）
+     * @return None
+     */
+    void begin(int label)
+    {
+        add('B', label, 0);
+    }
+
+    /**
+     * @brief 当前线程退出最近进入的区间
+     * @param label 区间名称编号（TimingLabel::id）
+     * @return None
+     */
+    void end(int label)
+    {
+        add('E', label, 0);
+    }
+
+    /**
+     * @brief 帧的起点（一般在采集区间内调用），箭头从当前线程所在区间出发
+     * @param frame_id 帧号
+     * @return None
+     */
+    void flow_begin(unsigned long frame_id)
+    {
+        add('s', kFlowLabel, frame_id);
+    }
+
+    /**
+     * @brief 帧经过的中间阶段，箭头经过当前线程所在区间
+     * @param frame_id 帧号
+     * @return None
+     */
+    void flow_step(unsigned long frame_id)
+    {
+        add('t', kFlowLabel, frame_id);
+    }
+
+    /**
+     * @brief 帧的终点（一般在osd绘制区间内调用），箭头指向当前线程所在区间
+     * @param frame_id 帧号
+     * @return None
+     */
+    void flow_end(unsigned long frame_id)
+    {
+        add('f', kFlowLabel, frame_id);
+    }
+
+    /**
+     * @brief 把所有线程已记录的事件写入json文件
+     * @return 成功返回true
+     */
+    bool write()
+    {
+        FILE *fp = fopen(file_.c_str(), "w");
+        if (fp == nullptr)
+        {
+            fprintf(stderr, "open trace file %s failed\n", file_.c_str());
+            return false;
+        }
+
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            buffers = buffers_;
+        }
+
+        fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+        unsigned long dropped = 0;
+        for (auto &tb : buffers)
+        {
+            std::lock_guard<std::mutex> lock(tb->mutex);
+            dropped += tb->dropped;
+            if (!tb->name.empty())
+            {
+                fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                        first ? "" : ",\n", tb->tid, escape(tb->name).c_str());
+                first = false;
+            }
+            for (const Event &e : tb->events)
+            {
+                fprintf(fp, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f",
+                        first ? "" : ",\n", e.label == kFlowLabel ? "frame" : escape(TimingLabel::lookup(e.label)).c_str(),
+                        e.ph, tb->tid, e.ts_us);
+                if (e.ph == 's' || e.ph == 't' || e.ph == 'f')
+                    fprintf(fp, ",\"cat\":\"frame\",\"id\":%lu%s", e.id, e.ph == 's' ? "" : ",\"bp\":\"e\"");
+                fprintf(fp, "}");
+                first = false;
+            }
+        }
+        fprintf(fp, "\n]}\n");
+        fclose(fp);
+
+        if (dropped)
+            fprintf(stderr, "trace: %lu events dropped (K230_TRACE_MAX_EVENTS)\n", dropped);
+        return true;
+    }
+
+    ~TraceRecorder()
+    {
+        if (enabled())
+            write();
+    }
+
+private:
+    struct Event
+    {
+        char ph;          // B/E：区间开始/结束；s/t/f：帧流向的起点/中间/终点
+        int label;        // 区间名称编号，流向事件为kFlowLabel
+        double ts_us;     // 相对记录器创建时刻的微秒数
+        unsigned long id; // 帧号，仅流向事件使用
+    };
+
+    struct ThreadBuffer
+    {
+        int tid;
+        std::string name;
+        std::vector<Event> events;
+        unsigned long dropped = 0;
+        std::mutex mutex; // 只在写文件时与记录线程竞争
+    };
+
+    TraceRecorder() : enabled_(false), max_events_(200000), start_(std::chrono::steady_clock::now())
+    {
+        // 析构时write要查名称，名称表需晚于记录器析构
+        TimingLabel::init_registry();
+        const char *max_events = getenv("K230_TRACE_MAX_EVENTS");
+        if (max_events)
+            max_events_ = strtoul(max_events, nullptr, 10);
+        const char *file = getenv("K230_TRACE_FILE");
+        if (file && file[0])
+            enable(file);
+    }
+
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+    ThreadBuffer &thread_buffer()
+    {
+        thread_local std::shared_ptr<ThreadBuffer> tb;
+        if (!tb)
+        {
+            // 缓冲区由记录器持有，线程退出后事件仍会写入文件
+            tb = std::make_shared<ThreadBuffer>();
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            tb->tid = (int)buffers_.size() + 1;
+            buffers_.push_back(tb);
+        }
+        return *tb;
+    }
+
+    void add(char ph, int label, unsigned long id)
+    {
+        if (!enabled())
+            return;
+        double ts_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_).count();
+        ThreadBuffer &tb = thread_buffer();
+        std::lock_guard<std::mutex> lock(tb.mutex);
+        if (tb.events.size() >= max_events_)
+        {
+            tb.dropped++;
+            return;
+        }
+        tb.events.push_back({ph, label, ts_us, id});
+    }
+
+    static std::string escape(const std::string &s)
+    {
+        std::string out;
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            if ((unsigned char)c < 0x20)
+                continue;
+            out += c;
+        }
+        return out;
+    }
+
+    static const int kFlowLabel = -1;
+
+    std::atomic<bool> enabled_;
+    std::string file_;
+    size_t max_events_;
+    std::chrono::steady_clock::time_point start_;
+
+    std::mutex buffers_mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+};
+
+#else
+
+/**
+ * @brief K230_PROFILER=0时的空实现，调用处无需条件编译
+ */
+class TraceRecorder
+{
+public:
+    static TraceRecorder &instance()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+    bool enabled() const { return false; }
+    void enable(const std::string &) {}
+    void set_thread_name(const std::string &) {}
+    void begin(int) {}
+    void end(int) {}
+    void flow_begin(unsigned long) {}
+    void flow_step(unsigned long) {}
+    void flow_end(unsigned long) {}
+    bool write() { return false; }
+};
+
+#endif
+
+#endif
@@ -356,6 +356,133 @@ void Utils::padding_resize_one_side(FrameCHWSize ori_shape, FrameSize resize_sha
     builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
 }
 
+void Utils::padding_resize_one_side_nv12(FrameCHWSize ori_shape, FrameSize resize_shape, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor, const cv::Scalar padding)
+{
+    int ori_w = ori_shape.width;
+    int ori_h = ori_shape.height;
+    int width = resize_shape.width;
+    int height = resize_shape.height;
+    float ratiow = (float)width / ori_w;
+    float ratioh = (float)height / ori_h;
+    float ratio = ratiow < ratioh ? ratiow : ratioh;
+    int new_w = (int)(ratio * ori_w);
+    int new_h = (int)(ratio * ori_h);
+    float dw = (float)(width - new_w) / 2;
+    float dh = (float)(height - new_h) / 2;
+    int top = (int)(roundf(0));
+    int bottom = (int)(roundf(dh * 2 + 0.1));
+    int left = (int)(roundf(0));
+    int right = (int)(roundf(dw * 2 - 0.1));
+
+    // run ai2d，nv12 -> rgb chw
+    ai2d_datatype_t ai2d_dtype{ai2d_format::YUV420_NV12, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
+    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
+    ai2d_shift_param_t shift_param{false, 0};
+    ai2d_pad_param_t pad_param{true, {{0, 0}, {0, 0}, {top, bottom}, {left, right}}, ai2d_pad_mode::constant, {padding[0], padding[1], padding[2]}};
+    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
+    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
+
+    dims_t in_shape = ai2d_in_tensor.shape();
+    dims_t out_shape = ai2d_out_tensor.shape();
+    builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
+    builder->build_schedule();
+    builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
+}
+
+// 计算half_pixel模式下bilinear插值的源坐标及权重（定点，权重和为1<<11）
+static void nv12_resize_table(int src_len, int dst_len, vector<int> &idx0, vector<int> &idx1, vector<int> &weight)
+{
+    idx0.resize(dst_len);
+    idx1.resize(dst_len);
+    weight.resize(dst_len);
+    float scale = (float)src_len / dst_len;
+    for (int i = 0; i < dst_len; ++i)
+    {
+        float src = (i + 0.5f) * scale - 0.5f;
+        src = std::max(src, 0.f);
+        int i0 = std::min((int)src, src_len - 1);
+        idx0[i] = i0;
+        idx1[i] = std::min(i0 + 1, src_len - 1);
+        weight[i] = (int)((src - i0) * 2048 + 0.5f);
+    }
+}
+
+void Utils::nv12_padding_resize_one_side(const uint8_t *nv12, const FrameSize &ori_size, const FrameSize &resize_shape, uint8_t *chw_out, const cv::Scalar padding)
+{
+    int ori_w = ori_size.width;
+    int ori_h = ori_size.height;
+    int width = resize_shape.width;
+    int height = resize_shape.height;
+    float ratiow = (float)width / ori_w;
+    float ratioh = (float)height / ori_h;
+    float ratio = ratiow < ratioh ? ratiow : ratioh;
+    int new_w = (int)(ratio * ori_w);
+    int new_h = (int)(ratio * ori_h);
+
+    const uint8_t *y_plane = nv12;
+    const uint8_t *uv_plane = nv12 + ori_w * ori_h;
+    size_t plane_size = width * height;
+    uint8_t *dst[3] = {chw_out, chw_out + plane_size, chw_out + 2 * plane_size};
+
+    // y平面与uv平面分别计算插值表，uv平面宽高为y平面的一半
+    vector<int> yx0, yx1, ywx, yy0, yy1, ywy;
+    vector<int> cx0, cx1, cwx, cy0, cy1, cwy;
+    nv12_resize_table(ori_w, new_w, yx0, yx1, ywx);
+    nv12_resize_table(ori_h, new_h, yy0, yy1, ywy);
+    nv12_resize_table(ori_w / 2, new_w, cx0, cx1, cwx);
+    nv12_resize_table(ori_h / 2, new_h, cy0, cy1, cwy);
+
+    for (int dy = 0; dy < new_h; ++dy)
+    {
+        const uint8_t *y_row0 = y_plane + yy0[dy] * ori_w;
+        const uint8_t *y_row1 = y_plane + yy1[dy] * ori_w;
+        const uint8_t *uv_row0 = uv_plane + cy0[dy] * ori_w;
+        const uint8_t *uv_row1 = uv_plane + cy1[dy] * ori_w;
+        int wy = ywy[dy];
+        int wcy = cwy[dy];
+        for (int dx = 0; dx < new_w; ++dx)
+        {
+            int wx = ywx[dx];
+            int top = y_row0[yx0[dx]] * (2048 - wx) + y_row0[yx1[dx]] * wx;
+            int bot = y_row1[yx0[dx]] * (2048 - wx) + y_row1[yx1[dx]] * wx;
+            int y = (top * (2048 - wy) + bot * wy + (1 << 21)) >> 22;
+
+            int wcx = cwx[dx];
+            int u0 = 2 * cx0[dx];
+            int u1 = 2 * cx1[dx];
+            int u_top = uv_row0[u0] * (2048 - wcx) + uv_row0[u1] * wcx;
+            int u_bot = uv_row1[u0] * (2048 - wcx) + uv_row1[u1] * wcx;
+            int v_top = uv_row0[u0 + 1] * (2048 - wcx) + uv_row0[u1 + 1] * wcx;
+            int v_bot = uv_row1[u0 + 1] * (2048 - wcx) + uv_row1[u1 + 1] * wcx;
+            int u = (u_top * (2048 - wcy) + u_bot * wcy + (1 << 21)) >> 22;
+            int v = (v_top * (2048 - wcy) + v_bot * wcy + (1 << 21)) >> 22;
+
+            // BT.601 limited range
+            int c = 298 * (y - 16);
+            int d = u - 128;
+            int e = v - 128;
+            int r = (c + 409 * e + 128) >> 8;
+            int g = (c - 100 * d - 208 * e + 128) >> 8;
+            int b = (c + 516 * d + 128) >> 8;
+            size_t offset = dy * width + dx;
+            dst[0][offset] = (uint8_t)std::min(std::max(r, 0), 255);
+            dst[1][offset] = (uint8_t)std::min(std::max(g, 0), 255);
+            dst[2][offset] = (uint8_t)std::min(std::max(b, 0), 255);
+        }
+    }
+
+    // 右侧、下方padding
+    for (int c = 0; c < 3; ++c)
+    {
+        uint8_t pad_value = (uint8_t)padding[c];
+        for (int dy = 0; dy < new_h; ++dy)
+        {
+            memset(dst[c] + dy * width + new_w, pad_value, width - new_w);
+        }
+        memset(dst[c] + new_h * width, pad_value, (height - new_h) * width);
+    }
+}
+
 void Utils::affine(FrameCHWSize ori_shape, std::vector<uint8_t> &ori_data, float *affine_matrix, runtime_tensor &ai2d_out_tensor)
 {
     runtime_tensor ai2d_in_tensor;
@@ -399,4 +526,60 @@ void Utils::affine(float *affine_matrix, std::unique_ptr<ai2d_builder> &builder,
     builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
     builder->build_schedule();
     builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
+}
+
+void Utils::warp_affine(const uint8_t *src, FrameCHWSize src_shape, const float *affine_matrix, uint8_t *dst, FrameCHWSize dst_shape)
+{
+    // dst = M * src，逐像素反算src坐标：src = M^-1 * dst
+    float a = affine_matrix[0], b = affine_matrix[1], tx = affine_matrix[2];
+    float c = affine_matrix[3], d = affine_matrix[4], ty = affine_matrix[5];
+    float det = a * d - b * c;
+    det = det != 0 ? 1.f / det : 0.f;
+    float ia = d * det, ib = -b * det, ic = -c * det, id = a * det;
+    float itx = -(ia * tx + ib * ty);
+    float ity = -(ic * tx + id * ty);
+
+    int src_w = src_shape.width;
+    int src_h = src_shape.height;
+    int dst_w = dst_shape.width;
+    int dst_h = dst_shape.height;
+    size_t src_plane = src_w * src_h;
+    size_t dst_plane = dst_w * dst_h;
+    int channel = std::min(src_shape.channel, dst_shape.channel);
+    const uint8_t border = 127;
+
+    for (int y = 0; y < dst_h; ++y)
+    {
+        float sx = ib * y + itx;
+        float sy = id * y + ity;
+        for (int x = 0; x < dst_w; ++x, sx += ia, sy += ic)
+        {
+            size_t offset = y * dst_w + x;
+            int x0 = (int)floorf(sx);
+            int y0 = (int)floorf(sy);
+            if (x0 < -1 || y0 < -1 || x0 >= src_w || y0 >= src_h)
+            {
+                for (int ch = 0; ch < channel; ++ch)
+                    dst[ch * dst_plane + offset] = border;
+                continue;
+            }
+
+            // 定点权重，和为1<<10
+            int wx = (int)((sx - x0) * 1024 + 0.5f);
+            int wy = (int)((sy - y0) * 1024 + 0.5f);
+            bool x0_in = x0 >= 0, x1_in = x0 + 1 < src_w;
+            bool y0_in = y0 >= 0, y1_in = y0 + 1 < src_h;
+            for (int ch = 0; ch < channel; ++ch)
+            {
+                const uint8_t *plane = src + ch * src_plane;
+                int p00 = (x0_in && y0_in) ? plane[y0 * src_w + x0] : border;
+                int p01 = (x1_in && y0_in) ? plane[y0 * src_w + x0 + 1] : border;
+                int p10 = (x0_in && y1_in) ? plane[(y0 + 1) * src_w + x0] : border;
+                int p11 = (x1_in && y1_in) ? plane[(y0 + 1) * src_w + x0 + 1] : border;
+                int top = p00 * (1024 - wx) + p01 * wx;
+                int bot = p10 * (1024 - wx) + p11 * wx;
+                dst[ch * dst_plane + offset] = (uint8_t)((top * (1024 - wy) + bot * wy + (1 << 19)) >> 20);
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -46,24 +46,16 @@ using std::ifstream;
 using std::vector;
 
 /**
- * @brief 人脸检测框
+ * @brief 检测框
  */
 typedef struct Bbox
 {
-    float x; // 人脸检测框的左顶点x坐标
-    float y; // 人脸检测框的左顶点x坐标
+    float x; // 检测框的左顶点x坐标
+    float y; // 检测框的左顶点x坐标
     float w;
     float h;
 } Bbox;
 
-/**
- * @brief 人脸五官点
- */
-typedef struct SparseLandmarks
-{
-    float points[10]; // 人脸五官点,依次是图片的左眼（x,y）、右眼（x,y）,鼻子（x,y）,左嘴角（x,y）,右嘴角
-} SparseLandmarks;
-
 /**
  * @brief 单张/帧图片大小
  */
@@ -93,18 +85,28 @@ public:
     /**
      * @brief 读取2进制文件
      * @param file_name 文件路径
-     * @return 文件对应类型的数据
+     * @return 文件对应类型的数据，打开或读取失败时为空（错误信息已打印）
      */
     template <class T>
     static vector<T> read_binary_file(const char *file_name)
     {
-        ifstream ifs(file_name, std::ios::binary);
-        ifs.seekg(0, ifs.end);
+        vector<T> vec;
+        ifstream ifs(file_name, std::ios::binary | std::ios::ate);
+        if (!ifs)
+        {
+            std::cerr << "read_binary_file: cannot open " << file_name << std::endl;
+            return vec;
+        }
         size_t len = ifs.tellg();
-        vector<T> vec(len / sizeof(T), 0);
+        if (len % sizeof(T) != 0)
+            std::cerr << "read_binary_file: " << file_name << " size " << len << " is not a multiple of " << sizeof(T) << std::endl;
+        vec.resize(len / sizeof(T));
         ifs.seekg(0, ifs.beg);
-        ifs.read(reinterpret_cast<char *>(vec.data()), len);
-        ifs.close();
+        if (!ifs.read(reinterpret_cast<char *>(vec.data()), vec.size() * sizeof(T)))
+        {
+            std::cerr << "read_binary_file: read " << file_name << " failed" << std::endl;
+            vec.clear();
+        }
         return vec;
     }
 
@@ -282,6 +284,30 @@ public:
      */
     static void padding_resize_one_side(FrameCHWSize ori_shape, FrameSize resize_shape, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor, const cv::Scalar padding);
 
+    // nv12 padding resize
+    /**
+     * @brief padding_resize函数（右或下padding），输入为nv12数据，在resize的同时完成yuv->rgb转换（ai2d for video）
+     * @param ori_shape        原始数据大小，channel无意义，height/width为y平面的高、宽
+     * @param resize_shape     resize之后的大小
+     * @param builder          ai2d构建器，用于运行ai2d
+     * @param ai2d_in_tensor   ai2d输入，shape为{1, 1, height * 3 / 2, width}
+     * @param ai2d_out_tensor  ai2d输出，rgb chw
+     * @param padding          填充值，用于resize时的等比例变换
+     * @return None
+     */
+    static void padding_resize_one_side_nv12(FrameCHWSize ori_shape, FrameSize resize_shape, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor, const cv::Scalar padding);
+
+    /**
+     * @brief padding_resize_one_side_nv12的cpu参考实现（bilinear + half_pixel，BT.601），用于在host上校验ai2d结果和测试性能
+     * @param nv12             原始nv12数据，y平面之后紧跟uv交错平面
+     * @param ori_size         原始数据宽、高（需为偶数）
+     * @param resize_shape     resize之后的大小
+     * @param chw_out          输出rgb chw数据，大小为3 * resize_shape.height * resize_shape.width
+     * @param padding          填充值（r, g, b）
+     * @return None
+     */
+    static void nv12_padding_resize_one_side(const uint8_t *nv12, const FrameSize &ori_size, const FrameSize &resize_shape, uint8_t *chw_out, const cv::Scalar padding);
+
     // affine
     /**
      * @brief 仿射变换函数，对chw数据进行仿射变换(for imgae)
@@ -302,6 +328,17 @@ public:
      * @return None
      */
     static void affine(float *affine_matrix, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor);
+
+    /**
+     * @brief 仿射变换cpu实现（cv2_bilinear，越界填127，与ai2d affine参数一致），适用于112*112这类小输出，省去每次重建ai2d_builder的开销
+     * @param src              原始数据（chw）
+     * @param src_shape        原始数据chw大小
+     * @param affine_matrix    仿射变换矩阵（2*3，src->dst）
+     * @param dst              输出数据（chw）
+     * @param dst_shape        输出数据chw大小
+     * @return None
+     */
+    static void warp_affine(const uint8_t *src, FrameCHWSize src_shape, const float *affine_matrix, uint8_t *dst, FrameCHWSize dst_shape);
 };
 
 #endif
@@ -51,6 +51,8 @@
 #include "mpi_vo_api.h"
 
 #include "vo_test_case.h"
+#include "frame_source.h"
+#include "display_sink.h"
 
 #include "k_connector_comm.h"
 #include "mpi_connector_api.h"
@@ -79,6 +81,19 @@
 #define osd_height                          (1920)
 #endif
 
+// ai通道（chn1）输出格式：0为rgb888 planar，1为nv12（数据量减半，由ai2d在resize时完成yuv->rgb）
+#ifndef SENSOR_NV12
+#define SENSOR_NV12 (0)
+#endif
+
+#if SENSOR_NV12
+#define SENSOR_PIXEL_FORMAT PIXEL_FORMAT_YVU_PLANAR_420
+#define SENSOR_FRAME_SIZE (SENSOR_HEIGHT * SENSOR_WIDTH * 3 / 2)
+#else
+#define SENSOR_PIXEL_FORMAT PIXEL_FORMAT_BGR_888_PLANAR
+#define SENSOR_FRAME_SIZE (SENSOR_CHANNEL * SENSOR_HEIGHT * SENSOR_WIDTH)
+#endif
+
 
 k_vb_config config;
 k_vicap_dev vicap_dev;
@@ -103,6 +118,7 @@ k_vo_draw_frame vo_frame = (k_vo_draw_frame) {
 
 static k_vb_blk_handle block;
 k_u32 g_pool_id;
+static bool vicap_display = true;   // vivcap_start_multi是否配置了vo显示
 
 int vo_creat_layer_test(k_vo_layer chn_id, layer_info *info)
 {
@@ -367,34 +383,43 @@ static void sample_vicap_unbind_vo(k_mpp_chn vicap_mpp_chn, k_mpp_chn vo_mpp_chn
     return;
 }
 
-int vivcap_start()
+// 各板型可接的sensor，多路采集时第i路（VICAP_DEV_ID_i）使用第i个
+#if defined(CONFIG_BOARD_K230_CANMV)
+static const k_vicap_sensor_type vicap_sensor_types[] = {
+    OV_OV5647_MIPI_CSI0_1920X1080_30FPS_10BIT_LINEAR,
+    OV_OV5647_MIPI_CSI1_1920X1080_30FPS_10BIT_LINEAR,
+    OV_OV5647_MIPI_CSI2_1920X1080_30FPS_10BIT_LINEAR};
+static const k_vicap_mclk_id vicap_mclk_ids[] = {VICAP_MCLK0, VICAP_MCLK1, VICAP_MCLK2};
+#else
+static const k_vicap_sensor_type vicap_sensor_types[] = {
+    IMX335_MIPI_2LANE_RAW12_2592X1944_30FPS_LINEAR};
+#endif
+#define VICAP_SENSOR_MAX ((int)(sizeof(vicap_sensor_types) / sizeof(vicap_sensor_types[0])))
+
+/**
+ * @brief 配置vb（每路采集的ai通道各5块buffer）、vo图层和osd
+ * @param dev_num 采集路数
+ * @param display 是否配置vo图层和osd，不送显时只配置采集用的vb
+ * @return 0表示成功
+ */
+int vicap_vb_init(int dev_num, bool display = true)
 {
     k_s32 ret = 0;
 
     k_u32 pool_id;
     k_vb_pool_config pool_config;
 
-    printf("sample_vicap ...\n");
-
-#if defined(CONFIG_BOARD_K230_CANMV)
-    sensor_type = OV_OV5647_MIPI_CSI0_1920X1080_30FPS_10BIT_LINEAR;
-    kd_mpi_vicap_set_mclk(VICAP_MCLK0, VICAP_PLL0_CLK_DIV4, 16, 1);
-#else
-    sensor_type = IMX335_MIPI_2LANE_RAW12_2592X1944_30FPS_LINEAR;
-#endif
-    vicap_dev = VICAP_DEV_ID_0;
-
     memset(&config, 0, sizeof(config));
     config.max_pool_cnt = 64;
-    //VB for YUV420SP output
+    //VB for YUV420SP output，只有送显的一路使用
     config.comm_pool[0].blk_cnt = 5;
     config.comm_pool[0].mode = VB_REMAP_MODE_NOCACHE;
     config.comm_pool[0].blk_size = VICAP_ALIGN_UP((ISP_CHN0_WIDTH * ISP_CHN0_HEIGHT * 3 / 2), VICAP_ALIGN_1K);
    
-    //VB for RGB888 output
-    config.comm_pool[1].blk_cnt = 5;
+    //VB for RGB888 / NV12 output
+    config.comm_pool[1].blk_cnt = 5 * dev_num;
     config.comm_pool[1].mode = VB_REMAP_MODE_NOCACHE;
-    config.comm_pool[1].blk_size = VICAP_ALIGN_UP((SENSOR_HEIGHT * SENSOR_WIDTH * 3 ), VICAP_ALIGN_1K);
+    config.comm_pool[1].blk_size = VICAP_ALIGN_UP(SENSOR_FRAME_SIZE, VICAP_ALIGN_1K);
 
     ret = kd_mpi_vb_set_config(&config);
     if (ret) {
@@ -419,6 +444,9 @@ int vivcap_start()
     }
     printf("sample_vicap ...kd_mpi_vicap_get_sensor_info\n");
 
+    if (!display)
+        return ret;
+
     // dwc_dsi_init();
     vo_layer_vdss_bind_vo_config();
 
@@ -434,8 +462,23 @@ int vivcap_start()
         printf("--------aa--------------g_pool_id is %d pool_id is %d \n",g_pool_id, pool_id);
     }
 
+    return ret;
+}
+
+/**
+ * @brief 启动一路采集：chn1输出ai数据（SENSOR_WIDTH x SENSOR_HEIGHT，SENSOR_PIXEL_FORMAT），
+ *        display为true时chn0输出yuv420sp并绑定到vo显示
+ * @param dev      vicap设备
+ * @param type     sensor类型
+ * @param display  是否送显
+ * @return 0表示成功
+ */
+int vicap_dev_start(k_vicap_dev dev, k_vicap_sensor_type type, bool display)
+{
+    k_s32 ret = 0;
+
     memset(&sensor_info, 0, sizeof(k_vicap_sensor_info));
-    ret = kd_mpi_vicap_get_sensor_info(sensor_type, &sensor_info);
+    ret = kd_mpi_vicap_get_sensor_info(type, &sensor_info);
     if (ret) {
         printf("sample_vicap, the sensor type not supported!\n");
         return ret;
@@ -461,7 +504,7 @@ int vivcap_start()
     dev_attr.cpature_frame = 0;
     memcpy(&dev_attr.sensor_info, &sensor_info, sizeof(k_vicap_sensor_info));
 
-    ret = kd_mpi_vicap_set_dev_attr(vicap_dev, dev_attr);
+    ret = kd_mpi_vicap_set_dev_attr(dev, dev_attr);
     if (ret) {
         printf("sample_vicap, kd_mpi_vicap_set_dev_attr failed.\n");
         return ret;
@@ -469,53 +512,56 @@ int vivcap_start()
 
     memset(&chn_attr, 0, sizeof(k_vicap_chn_attr));
 
-    //set chn0 output yuv420sp
-    chn_attr.out_win.h_start = 0;
-    chn_attr.out_win.v_start = 0;
-    chn_attr.out_win.width = ISP_CHN0_WIDTH;
-    chn_attr.out_win.height = ISP_CHN0_HEIGHT;
+    if (display)
+    {
+        //set chn0 output yuv420sp
+        chn_attr.out_win.h_start = 0;
+        chn_attr.out_win.v_start = 0;
+        chn_attr.out_win.width = ISP_CHN0_WIDTH;
+        chn_attr.out_win.height = ISP_CHN0_HEIGHT;
 
 
 #if defined(CONFIG_BOARD_K230_CANMV)
-    chn_attr.crop_win = dev_attr.acq_win;
+        chn_attr.crop_win = dev_attr.acq_win;
 #else
-    // chn_attr.crop_win = dev_attr.acq_win;
-    chn_attr.crop_win.h_start = 768;
-    chn_attr.crop_win.v_start = 16;
-    chn_attr.crop_win.width = ISP_CHN0_WIDTH;
-    chn_attr.crop_win.height = ISP_CHN0_HEIGHT;
+        // chn_attr.crop_win = dev_attr.acq_win;
+        chn_attr.crop_win.h_start = 768;
+        chn_attr.crop_win.v_start = 16;
+        chn_attr.crop_win.width = ISP_CHN0_WIDTH;
+        chn_attr.crop_win.height = ISP_CHN0_HEIGHT;
 #endif
 
-    chn_attr.scale_win = chn_attr.out_win;
-    chn_attr.crop_enable = K_FALSE;
-    chn_attr.scale_enable = K_FALSE;
-    // chn_attr.dw_enable = K_FALSE;
-    chn_attr.chn_enable = K_TRUE;
-    chn_attr.pix_format = PIXEL_FORMAT_YVU_PLANAR_420;
-    chn_attr.buffer_num = VICAP_MAX_FRAME_COUNT;//at least 3 buffers for isp
-    chn_attr.buffer_size = config.comm_pool[0].blk_size;
-    vicap_chn = VICAP_CHN_ID_0;
-
-    printf("sample_vicap ...kd_mpi_vicap_set_chn_attr, buffer_size[%d]\n", chn_attr.buffer_size);
-    ret = kd_mpi_vicap_set_chn_attr(vicap_dev, vicap_chn, chn_attr);
-    if (ret) {
-        printf("sample_vicap, kd_mpi_vicap_set_chn_attr failed.\n");
-        return ret;
-    }
+        chn_attr.scale_win = chn_attr.out_win;
+        chn_attr.crop_enable = K_FALSE;
+        chn_attr.scale_enable = K_FALSE;
+        // chn_attr.dw_enable = K_FALSE;
+        chn_attr.chn_enable = K_TRUE;
+        chn_attr.pix_format = PIXEL_FORMAT_YVU_PLANAR_420;
+        chn_attr.buffer_num = VICAP_MAX_FRAME_COUNT;//at least 3 buffers for isp
+        chn_attr.buffer_size = config.comm_pool[0].blk_size;
+        vicap_chn = VICAP_CHN_ID_0;
+
+        printf("sample_vicap ...kd_mpi_vicap_set_chn_attr, buffer_size[%d]\n", chn_attr.buffer_size);
+        ret = kd_mpi_vicap_set_chn_attr(dev, vicap_chn, chn_attr);
+        if (ret) {
+            printf("sample_vicap, kd_mpi_vicap_set_chn_attr failed.\n");
+            return ret;
+        }
 
-    //bind vicap chn 0 to vo
-    vicap_mpp_chn.mod_id = K_ID_VI;
-    vicap_mpp_chn.dev_id = vicap_dev;
-    vicap_mpp_chn.chn_id = vicap_chn;
+        //bind vicap chn 0 to vo
+        vicap_mpp_chn.mod_id = K_ID_VI;
+        vicap_mpp_chn.dev_id = dev;
+        vicap_mpp_chn.chn_id = vicap_chn;
 
-    vo_mpp_chn.mod_id = K_ID_VO;
-    vo_mpp_chn.dev_id = K_VO_DISPLAY_DEV_ID;
-    vo_mpp_chn.chn_id = K_VO_DISPLAY_CHN_ID1;
+        vo_mpp_chn.mod_id = K_ID_VO;
+        vo_mpp_chn.dev_id = K_VO_DISPLAY_DEV_ID;
+        vo_mpp_chn.chn_id = K_VO_DISPLAY_CHN_ID1;
 
-    sample_vicap_bind_vo(vicap_mpp_chn, vo_mpp_chn);
-    printf("sample_vicap ...dwc_dsi_init\n");
+        sample_vicap_bind_vo(vicap_mpp_chn, vo_mpp_chn);
+        printf("sample_vicap ...dwc_dsi_init\n");
+    }
 
-    //set chn1 output rgb888p
+    //set chn1 output rgb888p or nv12
     chn_attr.out_win.h_start = 0;
     chn_attr.out_win.v_start = 0;
     chn_attr.out_win.width = SENSOR_WIDTH ;
@@ -536,26 +582,26 @@ int vivcap_start()
     chn_attr.scale_enable = K_FALSE;
     // chn_attr.dw_enable = K_FALSE;
     chn_attr.chn_enable = K_TRUE;
-    chn_attr.pix_format = PIXEL_FORMAT_BGR_888_PLANAR;
+    chn_attr.pix_format = SENSOR_PIXEL_FORMAT;
     chn_attr.buffer_num = VICAP_MAX_FRAME_COUNT;//at least 3 buffers for isp
     chn_attr.buffer_size = config.comm_pool[1].blk_size;
 
     printf("sample_vicap ...kd_mpi_vicap_set_chn_attr, buffer_size[%d]\n", chn_attr.buffer_size);
-    ret = kd_mpi_vicap_set_chn_attr(vicap_dev, VICAP_CHN_ID_1, chn_attr);
+    ret = kd_mpi_vicap_set_chn_attr(dev, VICAP_CHN_ID_1, chn_attr);
     if (ret) {
         printf("sample_vicap, kd_mpi_vicap_set_chn_attr failed.\n");
         return ret;
     }
 
     printf("sample_vicap ...kd_mpi_vicap_init\n");
-    ret = kd_mpi_vicap_init(vicap_dev);
+    ret = kd_mpi_vicap_init(dev);
     if (ret) {
         printf("sample_vicap, kd_mpi_vicap_init failed.\n");
         // goto err_exit;
     }
 
     printf("sample_vicap ...kd_mpi_vicap_start_stream\n");
-    ret = kd_mpi_vicap_start_stream(vicap_dev);
+    ret = kd_mpi_vicap_start_stream(dev);
     if (ret) {
         printf("sample_vicap, kd_mpi_vicap_init failed.\n");
         // goto err_exit;
@@ -564,38 +610,56 @@ int vivcap_start()
     return ret;
 }
 
-int vivcap_stop()
+/**
+ * @brief 停止一路采集，display与vicap_dev_start时一致
+ * @param dev      vicap设备
+ * @param display  是否送显
+ * @return 0表示成功
+ */
+int vicap_dev_stop(k_vicap_dev dev, bool display)
 {
     printf("sample_vicap ...kd_mpi_vicap_stop_stream\n");
-    int ret = kd_mpi_vicap_stop_stream(vicap_dev);
+    int ret = kd_mpi_vicap_stop_stream(dev);
     if (ret) {
         printf("sample_vicap, kd_mpi_vicap_init failed.\n");
         return ret;
     }
 
-    ret = kd_mpi_vicap_deinit(vicap_dev);
+    ret = kd_mpi_vicap_deinit(dev);
     if (ret) {
         printf("sample_vicap, kd_mpi_vicap_deinit failed.\n");
         return ret;
     }
 
-    kd_mpi_vo_disable_video_layer(K_VO_LAYER1);
+    if (display)
+    {
+        kd_mpi_vo_disable_video_layer(K_VO_LAYER1);
+
+        vicap_mpp_chn.mod_id = K_ID_VI;
+        vicap_mpp_chn.dev_id = dev;
+        vicap_mpp_chn.chn_id = VICAP_CHN_ID_0;
 
-    vicap_mpp_chn.mod_id = K_ID_VI;
-    vicap_mpp_chn.dev_id = vicap_dev;
-    vicap_mpp_chn.chn_id = vicap_chn;
+        vo_mpp_chn.mod_id = K_ID_VO;
+        vo_mpp_chn.dev_id = K_VO_DISPLAY_DEV_ID;
+        vo_mpp_chn.chn_id = K_VO_DISPLAY_CHN_ID1;
 
-    vo_mpp_chn.mod_id = K_ID_VO;
-    vo_mpp_chn.dev_id = K_VO_DISPLAY_DEV_ID;
-    vo_mpp_chn.chn_id = K_VO_DISPLAY_CHN_ID1;
+        sample_vicap_unbind_vo(vicap_mpp_chn, vo_mpp_chn);
+    }
 
-    sample_vicap_unbind_vo(vicap_mpp_chn, vo_mpp_chn);
+    return 0;
+}
 
+/**
+ * @brief 所有采集停止后释放vb
+ * @return 0表示成功
+ */
+int vicap_vb_exit()
+{
     /*Allow one frame time for the VO to release the VB block*/
     k_u32 display_ms = 1000 / 33;
     usleep(1000 * display_ms);
 
-    ret = kd_mpi_vb_exit();
+    int ret = kd_mpi_vb_exit();
     if (ret) {
         printf("sample_vicap, kd_mpi_vb_exit failed.\n");
         return ret;
@@ -604,6 +668,240 @@ int vivcap_stop()
     return 0;
 }
 
+/**
+ * @brief 启动多路采集，第0路送显
+ * @param dev_num 采集路数，不超过VICAP_SENSOR_MAX
+ * @param display 是否送显，false时不初始化vo（不接显示运行，见display_to_vo）
+ * @return 0表示成功
+ */
+int vivcap_start_multi(int dev_num, bool display = true)
+{
+    printf("sample_vicap ...\n");
+    if (dev_num < 1 || dev_num > VICAP_SENSOR_MAX) {
+        printf("sample_vicap, %d sensors requested, this board supports %d.\n", dev_num, VICAP_SENSOR_MAX);
+        return -1;
+    }
+
+    // 单路程序沿用全局的vicap_dev/sensor_type
+    vicap_dev = VICAP_DEV_ID_0;
+    sensor_type = vicap_sensor_types[0];
+
+#if defined(CONFIG_BOARD_K230_CANMV)
+    for (int i = 0; i < dev_num; i++)
+        kd_mpi_vicap_set_mclk(vicap_mclk_ids[i], VICAP_PLL0_CLK_DIV4, 16, 1);
+#endif
+
+    vicap_display = display;
+    k_s32 ret = vicap_vb_init(dev_num, display);
+    if (ret)
+        return ret;
+
+    for (int i = 0; i < dev_num; i++)
+    {
+        ret = vicap_dev_start((k_vicap_dev)(VICAP_DEV_ID_0 + i), vicap_sensor_types[i], display && i == 0);
+        if (ret)
+            return ret;
+    }
+    return ret;
+}
+
+/**
+ * @brief 停止vivcap_start_multi启动的多路采集
+ * @param dev_num 采集路数
+ * @return 0表示成功
+ */
+int vivcap_stop_multi(int dev_num)
+{
+    for (int i = 0; i < dev_num; i++)
+    {
+        int ret = vicap_dev_stop((k_vicap_dev)(VICAP_DEV_ID_0 + i), vicap_display && i == 0);
+        if (ret)
+            return ret;
+    }
+    return vicap_vb_exit();
+}
+
+int vivcap_start(bool display = true)
+{
+    return vivcap_start_multi(1, display);
+}
+
+int vivcap_stop()
+{
+    return vivcap_stop_multi(1);
+}
+
+/**
+ * @brief vicap数据源：从一路vicap的chn1（ai通道）dump帧，retrieve时拷贝到调用者的isp内存后立即归还
+ */
+class VicapFrameSource : public FrameSource
+{
+public:
+    /**
+     * @brief VicapFrameSource构造函数
+     * @param dev  vicap设备，需已由vivcap_start/vivcap_start_multi启动
+     * @return None
+     */
+    VicapFrameSource(k_vicap_dev dev)
+        : FrameSource(SENSOR_WIDTH, SENSOR_HEIGHT, SENSOR_NV12 ? FRAME_NV12 : FRAME_RGB_PLANAR), dev_(dev), frame_id_(0), holding_(false), release_failures_(0)
+    {
+    }
+
+    ~VicapFrameSource()
+    {
+        discard();
+    }
+
+    bool grab(FrameInfo &info, int timeout_ms) override
+    {
+        // 先dump到临时帧：丢帧策略的非阻塞grab最后一次总是失败，失败时必须保留持有的帧
+        k_video_frame_info frame;
+        memset(&frame, 0, sizeof(k_video_frame_info));
+        int ret = kd_mpi_vicap_dump_frame(dev_, VICAP_CHN_ID_1, VICAP_DUMP_YUV, &frame, timeout_ms);
+        if (ret)
+        {
+            // timeout为0时只是没有排队的帧，不算失败
+            if (timeout_ms)
+                printf("sample_vicap...kd_mpi_vicap_dump_frame failed, dev %d.\n", (int)dev_);
+            return false;
+        }
+        discard();
+        frame_ = frame;
+        holding_ = true;
+        // 时间戳为出队时刻：策略丢弃排队的旧帧后，它与处理开始的差值即可反映排队延迟
+        info.frame_id = ++frame_id_;
+        info.timestamp_us = now_us();
+        return true;
+    }
+
+    bool retrieve(uint8_t *dst) override
+    {
+        if (!holding_)
+            return false;
+        size_t size = frame_size();
+        auto vbvaddr = kd_mpi_sys_mmap_cached(frame_.v_frame.phys_addr[0], size);
+        memcpy(dst, (void *)vbvaddr, size);
+        kd_mpi_sys_munmap(vbvaddr, size);
+        discard();
+        return true;
+    }
+
+    void discard() override
+    {
+        if (!holding_)
+            return;
+        holding_ = false;
+        int ret = kd_mpi_vicap_dump_release(dev_, VICAP_CHN_ID_1, &frame_);
+        if (ret)
+        {
+            printf("sample_vicap...kd_mpi_vicap_dump_release failed, dev %d.\n", (int)dev_);
+            release_failures_++;
+        }
+    }
+
+    /**
+     * @brief kd_mpi_vicap_dump_release失败的次数
+     * @return 次数
+     */
+    unsigned long release_failures() const
+    {
+        return release_failures_;
+    }
+
+    const char *name() const override
+    {
+        return "vicap";
+    }
+
+private:
+    k_vicap_dev dev_;               // vicap设备
+    k_video_frame_info frame_;      // grab取得、尚未归还的帧
+    unsigned long frame_id_;        // 已取得的帧数
+    bool holding_;                  // 是否持有未归还的帧
+    unsigned long release_failures_; // 归还失败次数
+};
+
+/**
+ * @brief vo送显：osd buffer为vo的VB block，show把画好的一块插入osd通道，需已由vivcap_start（display为true）初始化vo
+ */
+class VoDisplaySink : public DisplaySink
+{
+public:
+    /**
+     * @brief VoDisplaySink构造函数
+     * @param buffer_num  osd buffer数，轮流绘制、送显
+     * @return None
+     */
+    VoDisplaySink(int buffer_num = 2) : DisplaySink(osd_width, osd_height), vf_info_(buffer_num), blocks_(buffer_num)
+    {
+        for (int i = 0; i < buffer_num; ++i)
+        {
+            void *vaddr = nullptr;
+            memset(&vf_info_[i], 0, sizeof(vf_info_[i]));
+            vf_info_[i].v_frame.width = osd_width;
+            vf_info_[i].v_frame.height = osd_height;
+            vf_info_[i].v_frame.stride[0] = osd_width;
+            vf_info_[i].v_frame.pixel_format = PIXEL_FORMAT_ARGB_8888;
+            blocks_[i] = vo_insert_frame(&vf_info_[i], &vaddr);
+            buffers_.push_back(vaddr);
+        }
+        block = blocks_[0];         // 由vo_osd_release_block释放
+    }
+
+    ~VoDisplaySink()
+    {
+        vo_osd_release_block();
+        for (size_t i = 1; i < blocks_.size(); ++i)
+            kd_mpi_vb_release_block(blocks_[i]);
+    }
+
+    const char *name() const override
+    {
+        return "vo";
+    }
+
+protected:
+    bool present(int index) override
+    {
+        return kd_mpi_vo_chn_insert_frame(osd_id + 3, &vf_info_[index]) == 0; // K_VO_OSD0
+    }
+
+private:
+    std::vector<k_video_frame_info> vf_info_;   // 每块osd buffer的帧信息
+    std::vector<k_vb_blk_handle> blocks_;       // osd buffer的VB block
+};
+
+/**
+ * @brief K230_DISPLAY未设置或为vo时送显，null、录制路径时不接显示运行
+ * @return 送显返回true
+ */
+bool display_to_vo()
+{
+    const char *env = getenv("K230_DISPLAY");
+    return !env || !*env || strcmp(env, "vo") == 0;
+}
+
+/**
+ * @brief 按K230_DISPLAY创建osd输出：vo（默认）送显，null绘制后丢弃，其它值为录制路径（见RecordingDisplaySink）
+ *        vo输出需在vivcap_start(display_to_vo())之后创建
+ * @param buffer_num  osd buffer数
+ * @param fps         osd刷新帧率，录制为视频时作为视频帧率
+ * @return 输出
+ */
+std::unique_ptr<DisplaySink> display_sink_from_env(int buffer_num, float fps)
+{
+    if (display_to_vo())
+        return std::unique_ptr<DisplaySink>(new VoDisplaySink(buffer_num));
+    const char *env = getenv("K230_DISPLAY");
+    std::unique_ptr<DisplaySink> sink = open_display_sink(env, osd_width, osd_height, buffer_num, fps);
+    if (!sink)
+    {
+        std::cerr << "K230_DISPLAY=" << env << ": open display sink failed" << std::endl;
+        std::abort();
+    }
+    return sink;
+}
+
 void yuv_rotate_90(char *des, char *src,int width,int height)
 {
     int n = 0;
@@ -0,0 +1,139 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "video_file_source.h"
+
+#include <cstring>
+#include <iostream>
+#include <opencv2/imgproc.hpp>
+
+static float replay_fps(cv::VideoCapture &capture, float fps)
+{
+    if (fps >= 0)
+        return fps;
+    double native = capture.isOpened() ? capture.get(cv::CAP_PROP_FPS) : 0;
+    return native > 0 ? (float)native : 0.f;
+}
+
+VideoFileSource::VideoFileSource(const std::string &path, int width, int height, FrameFormat format, float fps, int loop)
+    : FrameSource(width, height, format), path_(path), capture_(path), loop_(loop), pass_(1),
+      clock_(replay_fps(capture_, fps)), next_(0), holding_(false)
+{
+    if (!capture_.isOpened())
+        std::cerr << path_ << ": open failed" << std::endl;
+}
+
+bool VideoFileSource::decode_next()
+{
+    if (capture_.grab())
+        return true;
+    if (loop_ > 0 && pass_ >= loop_)
+        return false;
+    pass_++;
+    capture_.set(cv::CAP_PROP_POS_FRAMES, 0);
+    return capture_.grab();
+}
+
+bool VideoFileSource::grab(FrameInfo &info, int timeout_ms)
+{
+    if (!capture_.isOpened())
+        return false;
+    uint64_t timestamp;
+    // 下一帧未到时保留持有的帧（丢帧策略的非阻塞grab）
+    if (!clock_.wait(next_, timeout_ms, timestamp))
+        return false;
+    // 解码放在grab中保证帧序号与视频帧一一对应；丢弃的帧省去颜色转换。
+    // capture_.grab之后OpenCV不能再retrieve之前的帧，因此只有到结尾时失败的grab会丢掉持有的帧
+    holding_ = false;
+    if (!decode_next())
+        return false;
+    holding_ = true;
+    info.frame_id = ++next_;
+    info.timestamp_us = timestamp;
+    return true;
+}
+
+bool VideoFileSource::retrieve(uint8_t *dst)
+{
+    if (!holding_)
+        return false;
+    holding_ = false;
+    if (!capture_.retrieve(bgr_) || bgr_.empty())
+        return false;
+    if (bgr_.cols != width_ || bgr_.rows != height_)
+        cv::resize(bgr_, resized_, cv::Size(width_, height_));
+    else
+        resized_ = bgr_;
+
+    size_t plane = (size_t)width_ * height_;
+    if (format_ == FRAME_NV12)
+    {
+        // i420的u、v平面交织为nv12的uv平面
+        cv::cvtColor(resized_, yuv_, cv::COLOR_BGR2YUV_I420);
+        const uint8_t *y = yuv_.data;
+        const uint8_t *u = y + plane;
+        const uint8_t *v = u + plane / 4;
+        memcpy(dst, y, plane);
+        uint8_t *uv = dst + plane;
+        for (size_t i = 0; i < plane / 4; i++)
+        {
+            uv[2 * i] = u[i];
+            uv[2 * i + 1] = v[i];
+        }
+    }
+    else
+    {
+        // bgr hwc -> rgb chw
+        uint8_t *r = dst;
+        uint8_t *g = dst + plane;
+        uint8_t *b = dst + 2 * plane;
+        for (int row = 0; row < height_; row++)
+        {
+            const uint8_t *src = resized_.ptr<uint8_t>(row);
+            size_t offset = (size_t)row * width_;
+            for (int col = 0; col < width_; col++)
+            {
+                b[offset + col] = src[3 * col];
+                g[offset + col] = src[3 * col + 1];
+                r[offset + col] = src[3 * col + 2];
+            }
+        }
+    }
+    return true;
+}
+
+void VideoFileSource::discard()
+{
+    holding_ = false;
+}
+
+const char *VideoFileSource::name() const
+{
+    return "video";
+}
+
+bool VideoFileSource::is_open() const
+{
+    return capture_.isOpened();
+}
@@ -0,0 +1,81 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _VIDEO_FILE_SOURCE_H
+#define _VIDEO_FILE_SOURCE_H
+
+#include <string>
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#include "frame_source.h"
+
+/**
+ * @brief 视频文件数据源（opencv videoio解码，仅主机编译）
+ * 解码后缩放到width x height，转换为rgb888 planar或nv12，与vicap ai通道的数据格式一致
+ */
+class VideoFileSource : public FrameSource
+{
+public:
+    /**
+     * @brief VideoFileSource构造函数
+     * @param path    视频文件路径
+     * @param width   帧宽
+     * @param height  帧高
+     * @param format  帧数据格式
+     * @param fps     回放帧率，0表示尽快出帧，<0表示按视频文件自身的帧率
+     * @param loop    回放遍数，0表示无限循环
+     * @return None
+     */
+    VideoFileSource(const std::string &path, int width, int height, FrameFormat format, float fps = 0.f, int loop = 1);
+
+    bool grab(FrameInfo &info, int timeout_ms) override;
+
+    bool retrieve(uint8_t *dst) override;
+
+    void discard() override;
+
+    const char *name() const override;
+
+    bool is_open() const;
+
+private:
+    /**
+     * @brief 按timeout等出帧时间并解码下一帧，到结尾时按loop_重新开始
+     * @return 成功返回true
+     */
+    bool decode_next();
+
+    std::string path_;          // 视频文件路径
+    cv::VideoCapture capture_;  // 解码器
+    int loop_;                  // 回放遍数，0表示无限循环
+    int pass_;                  // 当前是第几遍
+    ReplayClock clock_;         // 出帧节奏
+    unsigned long next_;        // 下一帧的序号（循环回放时累加）
+    bool holding_;              // 是否持有grab取得的帧
+    cv::Mat bgr_;               // 解码得到的bgr图像
+    cv::Mat resized_;           // 缩放后的图像
+    cv::Mat yuv_;               // nv12转换的中间结果（i420）
+};
+
+#endif
@@ -0,0 +1,133 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "video_stream.h"
+
+#include <string>
+
+static std::string stream_label(int id, const char *result = nullptr)
+{
+    std::string labels = "stream=\"" + std::to_string(id) + "\"";
+    if (result)
+        labels += std::string(",result=\"") + result + "\"";
+    return labels;
+}
+
+VideoStream::VideoStream(int id, std::unique_ptr<FrameSource> source, void *vaddr, uintptr_t paddr, int debug_mode)
+    : id_(id), source_(std::move(source)), policy_(LatencyPolicy::from_env()), vaddr_(reinterpret_cast<uint8_t *>(vaddr)), paddr_(paddr), frame_{0, 0},
+      fps_("stream " + std::to_string(id), debug_mode),
+      captured_(Metrics::instance().counter("k230_stream_frames_total", "Frames of each stream by result", stream_label(id, "captured"))),
+      failed_(Metrics::instance().counter("k230_stream_frames_total", "Frames of each stream by result", stream_label(id, "failed"))),
+      dropped_(Metrics::instance().counter("k230_stream_frames_total", "Frames of each stream by result", stream_label(id, "dropped"))),
+      processed_(Metrics::instance().counter("k230_stream_frames_total", "Frames of each stream by result", stream_label(id, "processed"))),
+      fps_gauge_(Metrics::instance().gauge("k230_stream_fps", "Processed frames per second of each stream", stream_label(id))),
+      faces_(Metrics::instance().gauge("k230_stream_faces", "Faces in the latest result of each stream", stream_label(id))),
+      age_(Metrics::instance().histogram("k230_stream_frame_age_ms", "Time from frame timestamp to result of each stream", stream_label(id)))
+{
+    if (!vaddr_)
+    {
+        owned_.resize(source_->frame_size());
+        vaddr_ = owned_.data();
+        paddr_ = 0;
+    }
+}
+
+void VideoStream::set_policy(const LatencyPolicy &policy)
+{
+    policy_ = policy;
+}
+
+bool VideoStream::capture()
+{
+    FrameInfo info;
+    bool ok = policy_.next(*source_, vaddr_, info);
+    dropped_.inc(policy_.last_dropped());
+    if (!ok)
+    {
+        failed_.inc();
+        return false;
+    }
+    frame_ = info;
+    captured_.inc();
+    return true;
+}
+
+void VideoStream::done(size_t faces)
+{
+    processed_.inc();
+    age_.observe((FrameSource::now_us() - frame_.timestamp_us) / 1000.0);
+    faces_.set(faces);
+    if (fps_.tick())
+        fps_gauge_.set(fps_.fps());
+}
+
+int VideoStream::id() const
+{
+    return id_;
+}
+
+FrameSource &VideoStream::source()
+{
+    return *source_;
+}
+
+uint8_t *VideoStream::data()
+{
+    return vaddr_;
+}
+
+uintptr_t VideoStream::paddr() const
+{
+    return paddr_;
+}
+
+const FrameInfo &VideoStream::frame() const
+{
+    return frame_;
+}
+
+double VideoStream::fps() const
+{
+    return fps_.fps();
+}
+
+uint64_t VideoStream::captured() const
+{
+    return captured_.value();
+}
+
+uint64_t VideoStream::failed() const
+{
+    return failed_.value();
+}
+
+uint64_t VideoStream::dropped() const
+{
+    return dropped_.value();
+}
+
+uint64_t VideoStream::processed() const
+{
+    return processed_.value();
+}
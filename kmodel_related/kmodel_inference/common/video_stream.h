@@ -0,0 +1,125 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _VIDEO_STREAM_H
+#define _VIDEO_STREAM_H
+
+#include <memory>
+#include <vector>
+#include "frame_source.h"
+#include "latency_policy.h"
+#include "fps_counter.hpp"
+#include "metrics.h"
+
+/**
+ * @brief 一路视频流
+ * 持有数据源、丢帧策略和该路的isp内存，记录最近一帧的信息，按stream="id"标签导出采集、丢弃、处理计数、帧龄和帧率；
+ * 多路流共用模型时，推理前把模型的输入切到当前流的isp内存（bind_isp）
+ */
+class VideoStream
+{
+public:
+    /**
+     * @brief VideoStream构造函数
+     * @param id          流编号，用于日志和指标标签
+     * @param source      数据源
+     * @param vaddr       isp内存虚拟地址（如mmz），为空时在堆上分配（主机测试）
+     * @param paddr       isp内存物理地址
+     * @param debug_mode  >0时每秒打印该路帧率
+     * @return None
+     */
+    VideoStream(int id, std::unique_ptr<FrameSource> source, void *vaddr = nullptr, uintptr_t paddr = 0, int debug_mode = 0);
+
+    /**
+     * @brief 设置丢帧策略，默认按K230_FRAME_POLICY
+     * @param policy 丢帧策略
+     * @return None
+     */
+    void set_policy(const LatencyPolicy &policy);
+
+    /**
+     * @brief 按丢帧策略从数据源读取一帧到isp内存
+     * @return 成功返回true
+     */
+    bool capture();
+
+    /**
+     * @brief 当前帧处理完成，更新该路处理计数、帧率和帧龄（完成时刻与帧时间戳之差）
+     * @param faces 当前帧结果中的人脸数
+     * @return None
+     */
+    void done(size_t faces);
+
+    int id() const;
+    FrameSource &source();
+
+    /**
+     * @brief isp内存
+     * @return 虚拟地址
+     */
+    uint8_t *data();
+
+    /**
+     * @brief isp内存物理地址，主机分配的内存为0
+     * @return 物理地址
+     */
+    uintptr_t paddr() const;
+
+    /**
+     * @brief 最近一次capture成功的帧信息
+     * @return 帧信息
+     */
+    const FrameInfo &frame() const;
+
+    /**
+     * @brief 最近一个统计周期的处理帧率
+     * @return 帧率
+     */
+    double fps() const;
+
+    uint64_t captured() const;
+    uint64_t failed() const;
+    uint64_t dropped() const;
+    uint64_t processed() const;
+
+private:
+    int id_;                                // 流编号
+    std::unique_ptr<FrameSource> source_;   // 数据源
+    LatencyPolicy policy_;                  // 丢帧策略
+    std::vector<uint8_t> owned_;            // 未传入isp内存时自行分配的内存
+    uint8_t *vaddr_;                        // isp内存虚拟地址
+    uintptr_t paddr_;                       // isp内存物理地址
+    FrameInfo frame_;                       // 最近一帧的信息
+    FpsCounter fps_;                        // 处理帧率
+
+    Counter &captured_;                     // k230_stream_frames_total{result="captured"}
+    Counter &failed_;                       // k230_stream_frames_total{result="failed"}
+    Counter &dropped_;                      // k230_stream_frames_total{result="dropped"}
+    Counter &processed_;                    // k230_stream_frames_total{result="processed"}
+    Gauge &fps_gauge_;                      // k230_stream_fps
+    Gauge &faces_;                          // k230_stream_faces
+    Histogram &age_;                        // k230_stream_frame_age_ms
+};
+
+#endif
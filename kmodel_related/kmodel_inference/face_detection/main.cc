@@ -27,11 +27,19 @@
 #include "utils.h"
 #include "vi_vo.h"
 #include "face_detection.h"
+#include "latest_mailbox.hpp"
+#include "fps_counter.hpp"
+#include "metrics.h"
+#include "latency_policy.h"
+#include "motion_gate.h"
 
 using std::cerr;
 using std::cout;
 using std::endl;
 
+#define OSD_BUFFER_NUM (2)
+#define OSD_FPS (30)
+
 std::atomic<bool> isp_stop(false);
 
 void print_usage(const char *name)
@@ -49,21 +57,17 @@ void print_usage(const char *name)
 
 void video_proc(char *argv[])
 {
-    vivcap_start();
-    // 设置osd参数
-    k_video_frame_info vf_info;
-    void *pic_vaddr = NULL;       //osd
-    memset(&vf_info, 0, sizeof(vf_info));
-    vf_info.v_frame.width = osd_width;
-    vf_info.v_frame.height = osd_height;
-    vf_info.v_frame.stride[0] = osd_width;
-    vf_info.v_frame.pixel_format = PIXEL_FORMAT_ARGB_8888;
-    block = vo_insert_frame(&vf_info, &pic_vaddr);
+    // K230_DISPLAY：vo（默认）送显；null照常绘制但不送显，不接显示时测推理吞吐；其它值为osd录制路径
+    vivcap_start(display_to_vo());
+    // 两块osd buffer轮流绘制、输出
+    std::unique_ptr<DisplaySink> display = display_sink_from_env(OSD_BUFFER_NUM, OSD_FPS);
+    cout << "display: " << display->name() << endl;
+    OsdCompositor osd(display->width(), display->height(), display->buffers());
 
     // alloc memory,get isp memory
     size_t paddr = 0;
     void *vaddr = nullptr;
-    size_t size = SENSOR_CHANNEL * SENSOR_HEIGHT * SENSOR_WIDTH;
+    size_t size = SENSOR_FRAME_SIZE;
     int ret = kd_mpi_sys_mmz_alloc_cached(&paddr, &vaddr, "allocate", "anonymous", size);
     if (ret)
     {
@@ -71,58 +75,137 @@ void video_proc(char *argv[])
         std::abort();
     }
 
-    FaceDetection fd(argv[1], atof(argv[2]),atof(argv[3]), {SENSOR_CHANNEL, SENSOR_HEIGHT, SENSOR_WIDTH}, reinterpret_cast<uintptr_t>(vaddr), reinterpret_cast<uintptr_t>(paddr), atoi(argv[5]));
+#if SENSOR_NV12
+    ai2d_format isp_format = ai2d_format::YUV420_NV12;
+#else
+    ai2d_format isp_format = ai2d_format::NCHW_FMT;
+#endif
+    FaceDetection fd(argv[1], atof(argv[2]),atof(argv[3]), {SENSOR_CHANNEL, SENSOR_HEIGHT, SENSOR_WIDTH}, reinterpret_cast<uintptr_t>(vaddr), reinterpret_cast<uintptr_t>(paddr), atoi(argv[5]), isp_format);
+    fd.memory_report();
+
+    // 运行状态指标，设置K230_METRICS_FILE或K230_METRICS_SOCKET时以Prometheus文本格式导出
+    Metrics &metrics = Metrics::instance();
+    Counter &frames_total = metrics.counter("k230_frames_total", "Frames captured from vicap");
+    Counter &frames_dropped = metrics.counter("k230_frames_dropped_total", "kd_mpi_vicap_dump_frame failures");
+    Counter &release_failed = metrics.counter("k230_dump_release_failures_total", "kd_mpi_vicap_dump_release failures");
+    // 邮箱只保留最新结果，published与drawn之差即osd来不及绘制而被覆盖的结果数
+    Counter &results_published = metrics.counter("k230_results_total", "Inference results by pipeline point", "point=\"published\"");
+    Counter &results_drawn = metrics.counter("k230_results_total", "Inference results by pipeline point", "point=\"drawn\"");
+    Counter &display_failed = metrics.counter("k230_display_failures_total", "Osd frames the display sink failed to show");
+    Gauge &inference_fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"inference\"");
+    Gauge &osd_fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"osd\"");
+    Gauge &faces = metrics.gauge("k230_faces", "Faces in the latest result");
+    Counter &frames_skipped = metrics.counter("k230_detections_skipped_total", "Frames whose detection was skipped by the motion gate");
+    Counter &policy_processed = metrics.counter("k230_policy_frames_total", "Frames processed or dropped by the latency policy", "result=\"processed\"");
+    Counter &policy_dropped = metrics.counter("k230_policy_frames_total", "Frames processed or dropped by the latency policy", "result=\"dropped\"");
+    Histogram &frame_age = metrics.histogram("k230_frame_age_ms", "Time from frame dequeue to result publish");
+
+    // K230_FRAME_POLICY：newest（默认，推理跟不上时只处理最新帧）、all（每帧都处理）、every:N、fps:F
+    VicapFrameSource source(vicap_dev);
+    LatencyPolicy policy = LatencyPolicy::from_env();
+    cout << "frame policy: " << policy.describe() << endl;
 
-    vector<FaceDetectionInfo> results;
+    // 画面变化的格子占比低于K230_MOTION_GATE（默认0.01，0为每帧检测）时跳过检测，osd保持上次的结果
+    const char *gate_env = getenv("K230_MOTION_GATE");
+    MotionGate gate(gate_env ? atof(gate_env) : 0.01f);
+
+    // osd线程按显示帧率取最新的检测结果绘制、送显，推理循环不等待绘制
+    LatestMailbox<vector<FaceDetectionInfo>> mailbox;
+    std::thread thread_osd([&]()
+    {
+        FpsCounter fps("osd", atoi(argv[5]));
+        TraceRecorder::instance().set_thread_name("osd");
+        auto period = std::chrono::microseconds(1000000 / OSD_FPS);
+        auto next = std::chrono::steady_clock::now();
+        while (!isp_stop)
+        {
+            if (mailbox.update())
+            {
+                int osd_index;
+                {
+                    ScopedTiming st("osd draw", atoi(argv[5]));
+                    // K230_TRACE_FILE开启时，时间线上从该帧的采集区间连一条箭头到这里
+                    TraceRecorder::instance().flow_end(mailbox.read_tag());
+                    // 直接画到osd buffer，只清除该buffer上次画过的区域
+                    osd.begin_frame();
+                    fd.draw_result(osd, mailbox.read_slot());
+                    osd_index = osd.end_frame();
+                }
+                {
+                    // 送显（或丢弃、录制）单独计时，与绘制耗时分开
+                    ScopedTiming st("osd show", atoi(argv[5]));
+                    if (!display->show(osd_index))
+                        display_failed.inc();
+                }
+                results_drawn.inc();
+                if (fps.tick())
+                    osd_fps.set(fps.fps());
+            }
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    FpsCounter fps("inference", atoi(argv[5]));
+    TraceRecorder::instance().set_thread_name("inference");
+    unsigned long frame_id = 0;
     while (!isp_stop)
     {
         ScopedTiming st("total time", 1);
+        FrameInfo frame;
         {
             ScopedTiming st("read capture", atoi(argv[5]));
-            // 从vivcap中读取一帧图像到dump_info
-            memset(&dump_info, 0, sizeof(k_video_frame_info));
-            ret = kd_mpi_vicap_dump_frame(vicap_dev, VICAP_CHN_ID_1, VICAP_DUMP_YUV, &dump_info, 1000);
-            if (ret)
+            // 按丢帧策略从vicap取一帧拷贝到isp内存，排队的旧帧只dump/release不拷贝
+            bool ok = policy.next(source, reinterpret_cast<uint8_t *>(vaddr), frame);
+            policy_dropped.inc(policy.last_dropped());
+            if (source.release_failures() > release_failed.value())
+                release_failed.inc(source.release_failures() - release_failed.value());
+            if (!ok)
             {
-                printf("sample_vicap...kd_mpi_vicap_dump_frame failed.\n");
+                frames_dropped.inc();
                 continue;
             }
+            frames_total.inc();
+            policy_processed.inc();
+            TraceRecorder::instance().flow_begin(++frame_id);
         }
 
+        bool infer;
         {
-            ScopedTiming st("isp copy", atoi(argv[5]));
-            auto vbvaddr = kd_mpi_sys_mmap_cached(dump_info.v_frame.phys_addr[0], size);
-            memcpy(vaddr, (void *)vbvaddr, SENSOR_HEIGHT * SENSOR_WIDTH * 3);  // 这里以后可以去掉，不用copy
-            kd_mpi_sys_munmap(vbvaddr, size);
+            ScopedTiming st("motion gate", atoi(argv[5]));
+#if SENSOR_NV12
+            infer = gate.update_luma(reinterpret_cast<uint8_t *>(vaddr), SENSOR_WIDTH, SENSOR_HEIGHT, SENSOR_WIDTH);
+#else
+            infer = gate.update_rgb_planar(reinterpret_cast<uint8_t *>(vaddr), SENSOR_WIDTH, SENSOR_HEIGHT);
+#endif
+        }
+        if (!infer)
+        {
+            frames_skipped.inc();
+            Profiler::instance().frame();
+            continue;
         }
 
+        // 检测结果直接写到邮箱的可写槽，发布后由osd线程绘制
+        vector<FaceDetectionInfo> &results = mailbox.write_slot();
         results.clear();
         fd.pre_process();
         fd.inference();
         // 旋转后图像
         fd.post_process({SENSOR_WIDTH, SENSOR_HEIGHT}, results);
-
-        cv::Mat osd_frame(osd_height, osd_width, CV_8UC4, cv::Scalar(0, 0, 0, 0));
-        {
-            ScopedTiming st("osd draw", atoi(argv[5]));
-            fd.draw_result(osd_frame,results,false);
-        }
-
-        {
-            ScopedTiming st("osd copy", atoi(argv[5]));
-            memcpy(pic_vaddr, osd_frame.data, osd_width * osd_height * 4);
-            // 显示通道插入帧
-            kd_mpi_vo_chn_insert_frame(osd_id + 3, &vf_info); // K_VO_OSD0
-
-            ret = kd_mpi_vicap_dump_release(vicap_dev, VICAP_CHN_ID_1, &dump_info);
-            if (ret)
-            {
-                printf("sample_vicap...kd_mpi_vicap_dump_release failed.\n");
-            }
-        }
+        TraceRecorder::instance().flow_step(frame_id);
+        faces.set(results.size());
+        mailbox.publish(frame_id);
+        results_published.inc();
+        frame_age.observe((FrameSource::now_us() - frame.timestamp_us) / 1000.0);
+        if (fps.tick())
+            inference_fps.set(fps.fps());
+        // K230_PROFILE=N时每N帧打印一次各阶段耗时分布
+        Profiler::instance().frame();
     }
 
-    vo_osd_release_block();
+    thread_osd.join();
+    display.reset();
     vivcap_stop();
 
     // free memory
@@ -33,11 +33,33 @@
 #include "vi_vo.h"
 #include "face_detection.h"
 #include "face_recognition.h"
+#include "face_tracker.h"
+#include "motion_gate.h"
+#include "face_quality.h"
+#include "embedding_aggregator.h"
+#include "latest_mailbox.hpp"
+#include "fps_counter.hpp"
+#include "metrics.h"
+#include "latency_policy.h"
+
+#if SENSOR_NV12
+#error "face_recognition needs rgb888 planar isp data for ai2d affine, build it with SENSOR_NV12=0"
+#endif
 
 using std::cerr;
 using std::cout;
 using std::endl;
 
+#define OSD_BUFFER_NUM (2)
+#define OSD_FPS (30)
+
+// osd线程绘制一个人脸需要的信息
+typedef struct FaceOsdInfo
+{
+    Bbox bbox;                      // 人脸检测框
+    FaceRecognitionInfo recg;       // 人脸识别结果
+} FaceOsdInfo;
+
 std::atomic<bool> isp_stop(false);
 std::atomic<bool> reg_stop(false);
 int flags;
@@ -93,16 +115,12 @@ void print_usage(const char *name)
 
 void video_proc(char *argv[])
 {
-    vivcap_start();
-    // 设置osd参数
-    k_video_frame_info vf_info;
-    void *pic_vaddr = NULL;       //osd
-    memset(&vf_info, 0, sizeof(vf_info));
-    vf_info.v_frame.width = osd_width;
-    vf_info.v_frame.height = osd_height;
-    vf_info.v_frame.stride[0] = osd_width;
-    vf_info.v_frame.pixel_format = PIXEL_FORMAT_ARGB_8888;
-    block = vo_insert_frame(&vf_info, &pic_vaddr);
+    // K230_DISPLAY：vo（默认）送显；null照常绘制但不送显，不接显示时测推理吞吐；其它值为osd录制路径
+    vivcap_start(display_to_vo());
+    // 两块osd buffer轮流绘制、输出
+    std::unique_ptr<DisplaySink> display = display_sink_from_env(OSD_BUFFER_NUM, OSD_FPS);
+    cout << "display: " << display->name() << endl;
+    OsdCompositor osd(display->width(), display->height(), display->buffers());
 
     // alloc memory,get isp memory
     size_t paddr = 0;
@@ -130,39 +148,142 @@ void video_proc(char *argv[])
     float recg_thres = atof(argv[6]);
     FaceRecognition face_recg(argv[4],atoi(argv[5]),recg_thres, {SENSOR_CHANNEL, SENSOR_HEIGHT, SENSOR_WIDTH}, reinterpret_cast<uintptr_t>(vaddr), reinterpret_cast<uintptr_t>(paddr), atoi(argv[8]));
     face_recg.database_init(argv[9]);
+    // K230_AFFINE：ai2d（默认，整帧affine）、ai2d_roi（拷贝人脸roi后affine）、cpu（cpu采样），debug_mode为1时对比pre_process_video耗时
+    const char *affine_env = getenv("K230_AFFINE");
+    if (affine_env && !face_recg.set_affine(affine_env))
+        std::cerr << "K230_AFFINE=" << affine_env << " not recognized (ai2d, ai2d_roi, cpu), using ai2d" << std::endl;
+    face_det.memory_report();
+    face_recg.memory_report();
+
+    // 运行状态指标，设置K230_METRICS_FILE或K230_METRICS_SOCKET时以Prometheus文本格式导出
+    Metrics &metrics = Metrics::instance();
+    Counter &frames_total = metrics.counter("k230_frames_total", "Frames captured from vicap");
+    Counter &frames_dropped = metrics.counter("k230_frames_dropped_total", "kd_mpi_vicap_dump_frame failures");
+    Counter &release_failed = metrics.counter("k230_dump_release_failures_total", "kd_mpi_vicap_dump_release failures");
+    // 邮箱只保留最新结果，published与drawn之差即osd来不及绘制而被覆盖的结果数
+    Counter &results_published = metrics.counter("k230_results_total", "Inference results by pipeline point", "point=\"published\"");
+    Counter &results_drawn = metrics.counter("k230_results_total", "Inference results by pipeline point", "point=\"drawn\"");
+    Counter &display_failed = metrics.counter("k230_display_failures_total", "Osd frames the display sink failed to show");
+    Gauge &inference_fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"inference\"");
+    Gauge &osd_fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"osd\"");
+    Gauge &faces = metrics.gauge("k230_faces", "Faces in the latest result");
+    Counter &recognitions_run = metrics.counter("k230_recognitions_total", "Faces recognized by kmodel or served from the track cache", "source=\"kmodel\"");
+    Counter &recognitions_cached = metrics.counter("k230_recognitions_total", "Faces recognized by kmodel or served from the track cache", "source=\"cache\"");
+
+    // 每条人脸轨迹缓存识别结果，只在新轨迹、检测置信度下降或超过K230_RECOGNIZE_PERIOD帧（默认30，1为每帧识别）时重新识别
+    const char *period_env = getenv("K230_RECOGNIZE_PERIOD");
+    FaceTracker tracker(0.3f, 5, 1, period_env ? atoi(period_env) : 30, 0.15f);
+    // 画面变化的格子占比低于K230_MOTION_GATE（默认0.01，0为每帧检测）时跳过检测，轨迹只做预测
+    const char *gate_env = getenv("K230_MOTION_GATE");
+    MotionGate gate(gate_env ? atof(gate_env) : 0.01f);
+    Counter &frames_skipped = metrics.counter("k230_detections_skipped_total", "Frames whose detection was skipped by the motion gate");
+    Counter &policy_processed = metrics.counter("k230_policy_frames_total", "Frames processed or dropped by the latency policy", "result=\"processed\"");
+    Counter &policy_dropped = metrics.counter("k230_policy_frames_total", "Frames processed or dropped by the latency policy", "result=\"dropped\"");
+    Histogram &frame_age = metrics.histogram("k230_frame_age_ms", "Time from frame dequeue to result publish");
+
+    // K230_FRAME_POLICY：newest（默认，推理跟不上时只处理最新帧）、all（每帧都处理）、every:N、fps:F
+    VicapFrameSource source(vicap_dev);
+    LatencyPolicy policy = LatencyPolicy::from_env();
+    cout << "frame policy: " << policy.describe() << endl;
+    // 需要识别时在K230_QUALITY_WINDOW帧（默认5，1为立即识别）内挑质量最好的一帧人脸识别
+    const char *window_env = getenv("K230_QUALITY_WINDOW");
+    BestFaceWindow best_face(window_env ? atoi(window_env) : 5);
+    // 按轨迹聚合识别特征（以人脸质量加权），聚合特征变化明显时才查询数据库
+    EmbeddingAggregator aggregator(face_recg.feature_num());
+    vector<float> embedding(face_recg.feature_num());
+    Counter &database_searches = metrics.counter("k230_database_searches_total", "Face database searches");
+    // isp为rgb planar，g平面近似作为亮度算清晰度
+    const uint8_t *isp_luma = reinterpret_cast<const uint8_t *>(vaddr) + SENSOR_HEIGHT * SENSOR_WIDTH;
+
+    // osd线程按显示帧率取最新的识别结果绘制、送显，推理循环不等待绘制
+    LatestMailbox<vector<FaceOsdInfo>> mailbox;
+    std::thread thread_osd([&]()
+    {
+        FpsCounter fps("osd", atoi(argv[8]));
+        TraceRecorder::instance().set_thread_name("osd");
+        auto period = std::chrono::microseconds(1000000 / OSD_FPS);
+        auto next = std::chrono::steady_clock::now();
+        while (!isp_stop)
+        {
+            if (mailbox.update())
+            {
+                int osd_index;
+                {
+                    ScopedTiming st("osd draw", atoi(argv[8]));
+                    // K230_TRACE_FILE开启时，时间线上从该帧的采集区间连一条箭头到这里
+                    TraceRecorder::instance().flow_end(mailbox.read_tag());
+                    // 直接画到osd buffer，只清除该buffer上次画过的区域
+                    osd.begin_frame();
+                    for (auto &face : mailbox.read_slot())
+                        face_recg.draw_result(osd, face.bbox, face.recg);
+                    osd_index = osd.end_frame();
+                }
+                {
+                    // 送显（或丢弃、录制）单独计时，与绘制耗时分开
+                    ScopedTiming st("osd show", atoi(argv[8]));
+                    if (!display->show(osd_index))
+                        display_failed.inc();
+                }
+                results_drawn.inc();
+                if (fps.tick())
+                    osd_fps.set(fps.fps());
+            }
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    });
 
     vector<FaceDetectionInfo> det_results;
+    FpsCounter fps("inference", atoi(argv[8]));
+    TraceRecorder::instance().set_thread_name("inference");
+    unsigned long frame_id = 0;
     while (!isp_stop)
     {       
         ScopedTiming st("total time", 1);
+        FrameInfo frame;
         {
             ScopedTiming st("read capture", atoi(argv[8]));
-            // 从vivcap中读取一帧图像到dump_info
-            memset(&dump_info, 0, sizeof(k_video_frame_info));
-            ret = kd_mpi_vicap_dump_frame(vicap_dev, VICAP_CHN_ID_1, VICAP_DUMP_YUV, &dump_info, 1000);
-            if (ret)
+            // 按丢帧策略从vicap取一帧拷贝到isp内存，排队的旧帧只dump/release不拷贝
+            bool ok = policy.next(source, reinterpret_cast<uint8_t *>(vaddr), frame);
+            policy_dropped.inc(policy.last_dropped());
+            if (source.release_failures() > release_failed.value())
+                release_failed.inc(source.release_failures() - release_failed.value());
+            if (!ok)
             {
-                printf("sample_vicap...kd_mpi_vicap_dump_frame failed.\n");
+                frames_dropped.inc();
                 continue;
             }
+            frames_total.inc();
+            policy_processed.inc();
+            TraceRecorder::instance().flow_begin(++frame_id);
         }
 
+        // 按键在运动门控之前读取：注册要用本帧的检测结果，按下i时本帧强制检测
+        char ch;
+        bool key = read(STDIN_FILENO, &ch, 1) > 0;
+        bool infer;
         {
-            ScopedTiming st("isp copy", atoi(argv[8]));
-            auto vbvaddr = kd_mpi_sys_mmap_cached(dump_info.v_frame.phys_addr[0], size);
-            memcpy(vaddr, (void *)vbvaddr, SENSOR_HEIGHT * SENSOR_WIDTH * 3);  // 这里以后可以去掉，不用copy
-            kd_mpi_sys_munmap(vbvaddr, size);
+            ScopedTiming st("motion gate", atoi(argv[8]));
+            if (key && ch == 'i')
+                gate.force();
+            infer = gate.update_rgb_planar(reinterpret_cast<uint8_t *>(vaddr), SENSOR_WIDTH, SENSOR_HEIGHT);
+        }
+        if (infer)
+        {
+            det_results.clear();
+            face_det.pre_process();
+            face_det.inference();
+            face_det.post_process({SENSOR_WIDTH, SENSOR_HEIGHT}, det_results);
+        }
+        else
+        {
+            frames_skipped.inc();
         }
 
-        det_results.clear();
-
-        face_det.pre_process();
-        face_det.inference();
-        face_det.post_process({SENSOR_WIDTH, SENSOR_HEIGHT}, det_results);
-
-        cv::Mat osd_frame(osd_height, osd_width, CV_8UC4, cv::Scalar(0, 0, 0, 0));
-        char ch;
-        if (read(STDIN_FILENO, &ch, 1) > 0) 
+        // 识别结果直接写到邮箱的可写槽，发布后由osd线程绘制
+        vector<FaceOsdInfo> &osd_results = mailbox.write_slot();
+        osd_results.clear();
+        if (key)
         {
             if (ch == 'i')      //for i key
             {
@@ -177,45 +298,58 @@ void video_proc(char *argv[])
                         max_id_face = i;
                     }
                 }
-           
-                //***for face recg***
-                face_recg.pre_process(det_results[max_id_face].sparse_kps.points);
-                face_recg.inference();
-
-                FaceRecognitionInfo recg_result;
-                face_recg.database_search(recg_result); 
-                face_recg.draw_result(osd_frame,det_results[max_id_face].bbox,recg_result,false);
-
-                string ret_name = "unknown";
-                if(recg_result.score>recg_thres)
-                    ret_name = recg_result.name;
-                
-                set_terminal_mode(true);
-                set_read_block_mode(true);
-                if(ret_name == "unknown" && face_recg.valid_register_face_ < max_register_face)
-                {    
-                    face_recg.database_insert(argv[9]);
+                if (max_id_face == -1)
+                {
+                    cerr<<"registration failed"<<endl;
+                    cerr<<"no face detected"<<endl;
                 }
                 else
                 {
-                    cerr<<"registration failed"<<endl;
-                    if(ret_name != "unknown")
-                    {
-                        cerr<<"face registered"<<endl;
+                    //***for face recg***
+                    face_recg.pre_process(det_results[max_id_face].sparse_kps.points);
+                    face_recg.inference();
+
+                    FaceRecognitionInfo recg_result;
+                    face_recg.database_search(recg_result); 
+                    osd_results.push_back({det_results[max_id_face].bbox, recg_result});
+
+                    string ret_name = "unknown";
+                    if(recg_result.score>recg_thres)
+                        ret_name = recg_result.name;
+                
+                    set_terminal_mode(true);
+                    set_read_block_mode(true);
+                    if(ret_name == "unknown" && face_recg.valid_register_face_ < max_register_face)
+                    {    
+                        face_recg.database_insert(argv[9]);
+                        tracker.reset(); // 缓存的unknown结果需要重新识别
+                        aggregator.reset();
                     }
-                    else if(face_recg.valid_register_face_ > max_register_face)
+                    else
                     {
-                        cerr<<"face database full"<<endl;
-                    }
+                        cerr<<"registration failed"<<endl;
+                        if(ret_name != "unknown")
+                        {
+                            cerr<<"face registered"<<endl;
+                        }
+                        else if(face_recg.valid_register_face_ > max_register_face)
+                        {
+                            cerr<<"face database full"<<endl;
+                        }
                     
+                    }
+                    std::this_thread::sleep_for(std::chrono::seconds(3));
+                    set_read_block_mode(false);
+                    set_terminal_mode(false);
+                    gate.force();
                 }
-                std::this_thread::sleep_for(std::chrono::seconds(3));
-                set_read_block_mode(false);
-                set_terminal_mode(false);
             }
             else if (ch == 'r')        //for r key
             {
                 face_recg.database_reset(argv[9]);
+                tracker.reset();
+                aggregator.reset();
+                gate.force();
                 std::this_thread::sleep_for(std::chrono::seconds(3));
             }
             else if(ch == 27)         //for ESC key
@@ -225,33 +359,63 @@ void video_proc(char *argv[])
         }
         else
         {
-            for (int i = 0; i < det_results.size(); ++i)
+            // 跳过检测的帧沿用轨迹的预测框和缓存的识别结果，不跑识别
+            for (auto &track : infer ? tracker.update(det_results) : tracker.predict())
             {
-                //***for face recg***
-                face_recg.pre_process(det_results[i].sparse_kps.points);
-                face_recg.inference();
-
-                FaceRecognitionInfo recg_result;
-                face_recg.database_search(recg_result); 
-                face_recg.draw_result(osd_frame,det_results[i].bbox,recg_result,false);
-            }
-        }
-        
+                // 本帧没有匹配到检测的轨迹不绘制
+                if (track.time_since_update != 0)
+                    continue;
+                if (infer && tracker.needs_recognition(track))
+                {
+                    // 质量比窗口内之前的帧好时才做对齐并保存，窗口结束时只识别最好的一帧
+                    float sharpness = FaceQuality::sharpness(isp_luma, SENSOR_WIDTH, SENSOR_HEIGHT, SENSOR_WIDTH, track.det.bbox);
+                    FaceQualityInfo quality = FaceQuality::score(track.det, sharpness);
+                    if (best_face.offer(track.id, quality.total))
+                    {
+                        //***for face recg***
+                        face_recg.pre_process(track.det.sparse_kps.points);
+                        face_recg.save_aligned(best_face.crop(track.id));
+                    }
+                    if (best_face.ready(track.id))
+                    {
+                        face_recg.load_aligned(best_face.crop(track.id));
+                        face_recg.inference();
+                        face_recg.get_embedding(embedding.data());
 
-        {
-            ScopedTiming st("osd copy", atoi(argv[8]));
-            memcpy(pic_vaddr, osd_frame.data, osd_width * osd_height * 4);
-            // 显示通道插入帧
-            kd_mpi_vo_chn_insert_frame(osd_id + 3, &vf_info); // K_VO_OSD0
-            ret = kd_mpi_vicap_dump_release(vicap_dev, VICAP_CHN_ID_1, &dump_info);
-            if (ret)
-            {
-                printf("sample_vicap...kd_mpi_vicap_dump_release failed.\n");
+                        FaceRecognitionInfo recg_result = {track.identity_id, track.identity_score, track.identity_name};
+                        if (aggregator.add(track.id, embedding.data(), best_face.best(track.id)))
+                        {
+                            face_recg.database_search(aggregator.aggregate(track.id), recg_result);
+                            aggregator.mark_searched(track.id);
+                            database_searches.inc();
+                        }
+                        tracker.set_identity(track, recg_result.id, recg_result.score, recg_result.name);
+                        best_face.finish(track.id);
+                        recognitions_run.inc();
+                    }
+                }
+                else
+                {
+                    recognitions_cached.inc();
+                }
+                osd_results.push_back({track.det.bbox, {track.identity_id, track.identity_score, track.identity_name}});
             }
+            best_face.retain(tracker.tracks());
+            aggregator.retain(tracker.tracks());
         }
+        TraceRecorder::instance().flow_step(frame_id);
+        faces.set(osd_results.size());
+        mailbox.publish(frame_id);
+        results_published.inc();
+        frame_age.observe((FrameSource::now_us() - frame.timestamp_us) / 1000.0);
+        if (fps.tick())
+            inference_fps.set(fps.fps());
+        // K230_PROFILE=N时每N帧打印一次各阶段耗时分布
+        Profiler::instance().frame();
     }
 
-    vo_osd_release_block();
+    thread_osd.join();
+    display.reset();
     vivcap_stop();
 
     // free memory
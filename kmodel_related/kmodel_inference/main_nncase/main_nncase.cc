@@ -1,57 +1,24 @@
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 #include <nncase/runtime/runtime_tensor.h>
 #include <nncase/runtime/interpreter.h>
 #include <nncase/runtime/runtime_op_utility.h>
+#include "binary_io.h"
+#include "mem_accounting.h"
+#include "nncase_dtype.h"
+#include "output_compare.h"
 
 using namespace nncase;
 using namespace nncase::runtime;
 using namespace nncase::runtime::detail;
 
-#define USE_CACHE 1
-
-template <class T>
-std::vector<T> read_binary_file(const char *file_name)
-{
-    std::ifstream ifs(file_name, std::ios::binary);
-    ifs.seekg(0, ifs.end);
-    size_t len = ifs.tellg();
-    std::vector<T> vec(len / sizeof(T), 0);
-    ifs.seekg(0, ifs.beg);
-    ifs.read(reinterpret_cast<char *>(vec.data()), len);
-    ifs.close();
-    return vec;
-}
-
-void read_binary_file(const char *file_name, char *buffer)
-{
-    std::ifstream ifs(file_name, std::ios::binary);
-    ifs.seekg(0, ifs.end);
-    size_t len = ifs.tellg();
-    ifs.seekg(0, ifs.beg);
-    ifs.read(buffer, len);
-    ifs.close();
-}
-
-template <typename T>
-double dot(const T *v1, const T *v2, size_t size)
-{
-    double ret = 0.f;
-    for (size_t i = 0; i < size; i++)
-    {
-        ret += v1[i] * v2[i];
-    }
-
-    return ret;
-}
-
-template <typename T>
-double cosine(const T *v1, const T *v2, size_t size)
-{
-    return dot(v1, v2, size) / ((sqrt(dot(v1, v1, size)) * sqrt(dot(v2, v2, size))));
-}
-
 void dump(const std::string &info, volatile float *p, size_t size)
 {
     std::cout << info << " dump: p = " << std::hex << (void *)p << std::dec << ", size = " << size << std::endl;
@@ -68,49 +35,125 @@ void dump(const std::string &info, volatile float *p, size_t size)
     std::cout << std::dec << std::endl;
 }
 
+/**
+ * @brief 一组耗时的统计结果（毫秒）
+ */
+struct LatencyStats
+{
+    double min_ms;
+    double mean_ms;
+    double median_ms;
+    double p99_ms;
+    double max_ms;
+    double stddev_ms;
+};
+
+static LatencyStats latency_stats(std::vector<double> samples)
+{
+    LatencyStats st = {0, 0, 0, 0, 0, 0};
+    if (samples.empty())
+        return st;
+    std::sort(samples.begin(), samples.end());
+    size_t n = samples.size();
+    double sum = 0;
+    for (double v : samples)
+        sum += v;
+    st.mean_ms = sum / n;
+    double var = 0;
+    for (double v : samples)
+        var += (v - st.mean_ms) * (v - st.mean_ms);
+    st.stddev_ms = n > 1 ? sqrt(var / (n - 1)) : 0;
+    st.min_ms = samples.front();
+    st.max_ms = samples.back();
+    st.median_ms = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+    st.p99_ms = samples[(n * 99 + 99) / 100 - 1]; // nearest-rank
+    return st;
+}
+
+static void print_stats(const char *name, const LatencyStats &st)
+{
+    printf("%-12s min %.3f ms, mean %.3f ms, median %.3f ms, p99 %.3f ms, max %.3f ms, stddev %.3f ms\n",
+           name, st.min_ms, st.mean_ms, st.median_ms, st.p99_ms, st.max_ms, st.stddev_ms);
+}
+
+static void json_stats(std::ostream &os, const char *name, const LatencyStats &st)
+{
+    os << "  \"" << name << "\": {\"min\": " << st.min_ms << ", \"mean\": " << st.mean_ms << ", \"median\": " << st.median_ms
+       << ", \"p99\": " << st.p99_ms << ", \"max\": " << st.max_ms << ", \"stddev\": " << st.stddev_ms << "},\n";
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point stop)
+{
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+static void usage(const char *prog)
+{
+    std::cerr << "Usage: " << prog << " [--warmup N] [--repeat M] [--time-io] [--json result.json] <kmodel> <input_0.bin> <input_1.bin> ... <input_N.bin> <output_0.bin> <output_1.bin> ... <output_N.bin>" << std::endl;
+    std::cerr << "  --warmup N     run N times before timing (default 0)" << std::endl;
+    std::cerr << "  --repeat M     time M runs and report min/mean/median/p99/stddev (default 1)" << std::endl;
+    std::cerr << "  --time-io      also time input sync and output map in every run" << std::endl;
+    std::cerr << "  --json file    write timings and compare results as json (- for stdout)" << std::endl;
+}
+
 int main(int argc, char *argv[])
 {
     std::cout << "case " << argv[0] << " build " << __DATE__ << " " << __TIME__ << std::endl;
-    if (argc < 4)
+
+    // 选项可以放在位置参数之前或之间，其余参数按原来的顺序：kmodel、各输入、各期望输出
+    int warmup = 0;
+    int repeat = 1;
+    bool time_io = false;
+    std::string json_file;
+    std::vector<char *> args{argv[0]};
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt = argv[i];
+        if (opt == "--warmup" && i + 1 < argc)
+            warmup = atoi(argv[++i]);
+        else if (opt == "--repeat" && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else if (opt == "--json" && i + 1 < argc)
+            json_file = argv[++i];
+        else if (opt == "--time-io")
+            time_io = true;
+        else if (opt.compare(0, 2, "--") == 0)
+        {
+            usage(argv[0]);
+            return -1;
+        }
+        else
+            args.push_back(argv[i]);
+    }
+    if (args.size() < 4 || warmup < 0 || repeat < 1)
     {
-        std::cerr << "Usage: " << argv[0] << " <kmodel> <input_0.bin> <input_1.bin> ... <input_N.bin> <output_0.bin> <output_1.bin> ... <output_N.bin>" << std::endl;
+        usage(argv[0]);
         return -1;
     }
+    int nargs = (int)args.size();
 
     interpreter interp;                             
 
-    // 1. load model
-    std::ifstream in_before_load_kmodel("/proc/media-mem");
-    std::string line_before_load_kmodel;
-    // 逐行读取文件内容，查看MMZ使用情况
-    while (std::getline(in_before_load_kmodel, line_before_load_kmodel)) { 
-        std::cout << line_before_load_kmodel << std::endl;
-    }
-
-    std::ifstream ifs(argv[1], std::ios::binary);
+    // 1. load model，各阶段的mmz和堆内存变化由MemTracker记录，最后统一打印
+    MemTracker mem_tracker(args[1], true);
+    std::ifstream ifs(args[1], std::ios::binary);
     interp.load_model(ifs).expect("Invalid kmodel");
-
-    std::ifstream in_after_load_kmodel("/proc/media-mem");
-    std::string line_after_load_kmodel;
-    // 逐行读取文件内容，查看MMZ使用情况
-    while (std::getline(in_after_load_kmodel, line_after_load_kmodel)) {  
-        std::cout << line_after_load_kmodel << std::endl;  
-    }
+    mem_tracker.mark("load_model");
 
     // 2. set inputs
+    std::vector<runtime_tensor> inputs;
     for (size_t i = 2, j = 0; i < 2 + interp.inputs_size(); i++, j++)
     {
         auto desc = interp.input_desc(j);
         auto shape = interp.input_shape(j);
         auto tensor = host_runtime_tensor::create(desc.datatype, shape, hrt::pool_shared).expect("cannot create input tensor");
         auto mapped_buf = std::move(hrt::map(tensor, map_access_::map_write).unwrap());
-#if USE_CACHE
-        read_binary_file(argv[i], reinterpret_cast<char *>(mapped_buf.buffer().data()));
-#else
-        auto vec = read_binary_file<unsigned char>(argv[i]);
-        memcpy(reinterpret_cast<void *>(mapped_buf.buffer().data()), reinterpret_cast<void *>(vec.data()), vec.size());
-        // dump("app dump input vector", (volatile float *)vec.data(), 32);
-#endif
+        // 直接读到tensor映射出来的buffer，文件大小必须与输入tensor一致
+        if (!BinaryIO::read_exact(args[i], mapped_buf.buffer().data(), mapped_buf.buffer().size_bytes()))
+        {
+            std::cerr << "load input " << j << " failed" << std::endl;
+            std::abort();
+        }
         auto ret = mapped_buf.unmap();
         ret = hrt::sync(tensor, sync_op_t::sync_write_back, true);
         if (!ret.is_ok())
@@ -121,7 +164,9 @@ int main(int argc, char *argv[])
 
         // dump("app dump input block", (volatile float *)block.virtual_address, 32);
         interp.input_tensor(j, tensor).expect("cannot set input tensor");
+        inputs.push_back(tensor);
     }
+    mem_tracker.mark("input tensors");
 
     // 3. set outputs
     for (size_t i = 0; i < interp.outputs_size(); i++)
@@ -131,32 +176,128 @@ int main(int argc, char *argv[])
         auto tensor = host_runtime_tensor::create(desc.datatype, shape, hrt::pool_shared).expect("cannot create output tensor");
         interp.output_tensor(i, tensor).expect("cannot set output tensor");
     }
+    mem_tracker.mark("output tensors");
+
+    // 4. run：先跑warmup次（首次运行的cache、页表等开销不计入），再计时repeat次
+    std::vector<double> run_ms, sync_ms, map_ms;
+    for (int r = 0; r < warmup + repeat; r++)
+    {
+        bool timed = r >= warmup;
+        if (time_io)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (auto &tensor : inputs)
+                hrt::sync(tensor, sync_op_t::sync_write_back, true).expect("sync write_back failed");
+            if (timed)
+                sync_ms.push_back(elapsed_ms(start, std::chrono::steady_clock::now()));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        interp.run().expect("error occurred in running model");
+        auto stop = std::chrono::steady_clock::now();
+        if (timed)
+            run_ms.push_back(elapsed_ms(start, stop));
+
+        if (time_io)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < interp.outputs_size(); i++)
+            {
+                auto out = interp.output_tensor(i).expect("cannot get output tensor");
+                auto mapped_buf = std::move(hrt::map(out, map_access_::map_read).unwrap());
+                auto ret = mapped_buf.unmap();
+                if (!ret.is_ok())
+                {
+                    std::cerr << "unmap output " << i << " failed" << std::endl;
+                    std::abort();
+                }
+            }
+            if (timed)
+                map_ms.push_back(elapsed_ms(start, std::chrono::steady_clock::now()));
+        }
+    }
+
+    mem_tracker.mark("run");
+    mem_tracker.report();
 
-    // 4. run
-    auto start = std::chrono::steady_clock::now();
-    interp.run().expect("error occurred in running model");
-    auto stop = std::chrono::steady_clock::now();
-    double duration = std::chrono::duration<double, std::milli>(stop - start).count();
-    std::cout << "interp run: " << duration << " ms, fps = " << 1000 / duration << std::endl;
+    LatencyStats run_stats = latency_stats(run_ms);
+    if (repeat == 1)
+    {
+        std::cout << "interp run: " << run_stats.mean_ms << " ms, fps = " << 1000 / run_stats.mean_ms << std::endl;
+    }
+    else
+    {
+        std::cout << "warmup " << warmup << ", repeat " << repeat << std::endl;
+        print_stats("interp run", run_stats);
+        std::cout << "fps = " << 1000 / run_stats.mean_ms << " (mean), " << 1000 / run_stats.median_ms << " (median)" << std::endl;
+    }
+    if (time_io)
+    {
+        print_stats("input sync", latency_stats(sync_ms));
+        print_stats("output map", latency_stats(map_ms));
+    }
 
     // 5. get outputs
-    for (int i = 2 + interp.inputs_size(), j = 0; i < argc; i++, j++)
+    std::vector<CompareResult> compare_results; // 期望文件大小不符时各项为0
+    for (int i = 2 + interp.inputs_size(), j = 0; i < nargs; i++, j++)
     {
         auto out = interp.output_tensor(j).expect("cannot get output tensor");
         auto mapped_buf = std::move(hrt::map(out, map_access_::map_read).unwrap());
-        auto expected = read_binary_file<unsigned char>(argv[i]);
+        MappedFile expected(args[i]);
+        if (!expected.is_open() || expected.size() != mapped_buf.buffer().size_bytes())
+        {
+            std::cerr << "compare output " << j << " Fail: expected file size " << expected.size() << " != output size " << mapped_buf.buffer().size_bytes() << std::endl;
+            compare_results.push_back(CompareResult{0, false, 0, 0, 0, -1});
+            continue;
+        }
 
-        // 6. compare
-        int ret = memcmp((void *)mapped_buf.buffer().data(), (void *)expected.data(), expected.size());
-        if (!ret)
+        // 6. compare：按输出的实际数据类型比较，uint8/float16输出不再当作float
+        TensorDType dtype = DT_UINT8;
+        to_tensor_dtype(interp.output_desc(j).datatype, dtype);
+        CompareResult result = OutputCompare::compare(mapped_buf.buffer().data(), expected.data(), expected.size(), dtype);
+        if (result.bit_exact)
         {
             std::cout << "compare output " << j << " Pass!" << std::endl;
         }
         else
         {
-            auto cos = cosine((const float *)mapped_buf.buffer().data(), (const float *)expected.data(), expected.size()/sizeof(float));
-            std::cerr << "compare output " << j << " Fail: cosine similarity = " << cos << std::endl;
+            std::cerr << "compare output " << j << " Fail: " << OutputCompare::dtype_name(dtype) << ", cosine similarity = " << result.cosine
+                      << ", max abs = " << result.max_abs << ", rmse = " << result.rmse << std::endl;
+        }
+        compare_results.push_back(result);
+    }
+
+    // 6. json结果，便于跨nncase版本、量化方式（build_model_int16.sh等）对比
+    if (!json_file.empty())
+    {
+        std::ofstream json_ofs;
+        if (json_file != "-")
+        {
+            json_ofs.open(json_file);
+            if (!json_ofs)
+            {
+                std::cerr << "open " << json_file << " failed" << std::endl;
+                return -1;
+            }
+        }
+        std::ostream &os = json_file == "-" ? std::cout : json_ofs;
+        os << "{\n";
+        os << "  \"kmodel\": \"" << args[1] << "\",\n";
+        os << "  \"warmup\": " << warmup << ",\n";
+        os << "  \"repeat\": " << repeat << ",\n";
+        json_stats(os, "run_ms", run_stats);
+        if (time_io)
+        {
+            json_stats(os, "input_sync_ms", latency_stats(sync_ms));
+            json_stats(os, "output_map_ms", latency_stats(map_ms));
         }
+        os << "  \"memory_kb\": {\"mmz_peak\": " << mem_tracker.peak_mmz_bytes() / 1024.0 << ", \"mmz_steady\": " << mem_tracker.steady_mmz_bytes() / 1024.0
+           << ", \"rss_steady\": " << mem_tracker.steady_rss_bytes() / 1024.0 << "},\n";
+        os << "  \"outputs\": [";
+        for (size_t k = 0; k < compare_results.size(); k++)
+            os << (k ? ", " : "") << "{\"index\": " << k << ", \"match\": " << (compare_results[k].bit_exact ? "true" : "false")
+               << ", \"cosine\": " << compare_results[k].cosine << ", \"max_abs\": " << compare_results[k].max_abs << ", \"rmse\": " << compare_results[k].rmse << "}";
+        os << "]\n}\n";
     }
 
     return 0;
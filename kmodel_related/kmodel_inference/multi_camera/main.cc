@@ -0,0 +1,336 @@
+/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include "utils.h"
+#include "vi_vo.h"
+#include "face_detection.h"
+#include "face_recognition.h"
+#include "face_tracker.h"
+#include "motion_gate.h"
+#include "face_quality.h"
+#include "embedding_aggregator.h"
+#include "video_stream.h"
+#include "stream_scheduler.h"
+#include "latest_mailbox.hpp"
+#include "fps_counter.hpp"
+#include "metrics.h"
+
+#if SENSOR_NV12
+#error "multi_camera needs rgb888 planar isp data for ai2d affine, build it with SENSOR_NV12=0"
+#endif
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#define OSD_BUFFER_NUM (2)
+#define OSD_FPS (30)
+
+// osd线程绘制一个人脸需要的信息
+typedef struct FaceOsdInfo
+{
+    Bbox bbox;                      // 人脸检测框
+    FaceRecognitionInfo recg;       // 人脸识别结果
+} FaceOsdInfo;
+
+/**
+ * @brief 一路摄像头的流水线状态：视频流（数据源、isp内存）以及该路的跟踪、跳帧、选帧、特征聚合和最新结果，
+ *        检测、识别模型由所有流共用
+ */
+typedef struct CameraPipeline
+{
+    CameraPipeline(int id, void *vaddr, uintptr_t paddr, int debug_mode, int recognize_period, float gate_ratio, int quality_window, int feature_num)
+        : stream(id, std::unique_ptr<FrameSource>(new VicapFrameSource((k_vicap_dev)(VICAP_DEV_ID_0 + id))), vaddr, paddr, debug_mode),
+          tracker(0.3f, 5, 1, recognize_period, 0.15f), gate(gate_ratio), best_face(quality_window), aggregator(feature_num)
+    {
+    }
+
+    VideoStream stream;                 // 数据源和isp内存
+    FaceTracker tracker;                // 人脸跟踪，缓存每条轨迹的识别结果
+    MotionGate gate;                    // 检测跳帧
+    BestFaceWindow best_face;           // 识别选帧
+    EmbeddingAggregator aggregator;     // 按轨迹聚合识别特征
+    vector<FaceDetectionInfo> det_results; // 最近一次检测结果
+    vector<FaceOsdInfo> results;        // 最新识别结果
+} CameraPipeline;
+
+std::atomic<bool> isp_stop(false);
+
+void print_usage(const char *name)
+{
+    cout << "Usage: " << name << "<kmodel_det> <det_thres> <nms_thres> <kmodel_recg> <max_register_face> <recg_thres> <stream_num> <debug_mode> <db_dir>" << endl
+         << "Options:" << endl
+         << "  kmodel_det               人脸检测kmodel路径\n"
+         << "  det_thres                人脸检测阈值\n"
+         << "  nms_thres                人脸检测nms阈值\n"
+         << "  kmodel_recg              人脸识别kmodel路径\n"
+         << "  max_register_face        人脸识别数据库最大容量\n"
+         << "  recg_thres               人脸识别阈值\n"
+         << "  stream_num               摄像头路数，第0路送显\n"
+         << "  debug_mode               是否需要调试，0、1、2分别表示不调试、耗时统计调试、预处理调试\n"
+         << "  db_dir                   数据库目录（由face_recognition.elf注册）\n"
+         << "\n"
+         << endl;
+}
+
+// K230_STREAM_WEIGHTS="2,1"：各路的调度权重，未给出的为1
+static std::vector<float> stream_weights(int stream_num)
+{
+    std::vector<float> weights(stream_num, 1.f);
+    const char *env = getenv("K230_STREAM_WEIGHTS");
+    if (env)
+    {
+        std::stringstream ss(env);
+        std::string item;
+        for (int i = 0; i < stream_num && std::getline(ss, item, ','); i++)
+            weights[i] = atof(item.c_str());
+    }
+    return weights;
+}
+
+void video_proc(char *argv[])
+{
+    int stream_num = atoi(argv[7]);
+    int debug_mode = atoi(argv[8]);
+    // K230_DISPLAY：vo（默认）第0路送显；null照常绘制但不送显，不接显示时测推理吞吐；其它值为osd录制路径
+    if (vivcap_start_multi(stream_num, display_to_vo()))
+    {
+        std::cerr << "vivcap_start_multi failed, stream_num = " << stream_num << std::endl;
+        std::abort();
+    }
+    // 两块osd buffer轮流绘制、输出
+    std::unique_ptr<DisplaySink> display = display_sink_from_env(OSD_BUFFER_NUM, OSD_FPS);
+    cout << "display: " << display->name() << endl;
+    OsdCompositor osd(display->width(), display->height(), display->buffers());
+
+    // 每路一块isp内存，模型推理前切换到当前流的内存
+    size_t size = SENSOR_FRAME_SIZE;
+    std::vector<size_t> paddrs(stream_num, 0);
+    std::vector<void *> vaddrs(stream_num, nullptr);
+    for (int i = 0; i < stream_num; i++)
+    {
+        int ret = kd_mpi_sys_mmz_alloc_cached(&paddrs[i], &vaddrs[i], "allocate", "anonymous", size);
+        if (ret)
+        {
+            std::cerr << "physical_memory_block::allocate failed: ret = " << ret << ", errno = " << strerror(errno) << std::endl;
+            std::abort();
+        }
+    }
+
+    FaceDetection face_det(argv[1], atof(argv[2]), atof(argv[3]), {SENSOR_CHANNEL, SENSOR_HEIGHT, SENSOR_WIDTH}, reinterpret_cast<uintptr_t>(vaddrs[0]), reinterpret_cast<uintptr_t>(paddrs[0]), debug_mode);
+    FaceRecognition face_recg(argv[4], atoi(argv[5]), atof(argv[6]), {SENSOR_CHANNEL, SENSOR_HEIGHT, SENSOR_WIDTH}, reinterpret_cast<uintptr_t>(vaddrs[0]), reinterpret_cast<uintptr_t>(paddrs[0]), debug_mode);
+    face_recg.database_init(argv[9]);
+    // K230_AFFINE：ai2d（默认，整帧affine）、ai2d_roi（拷贝人脸roi后affine）、cpu（cpu采样），debug_mode为1时对比pre_process_video耗时
+    const char *affine_env = getenv("K230_AFFINE");
+    if (affine_env && !face_recg.set_affine(affine_env))
+        std::cerr << "K230_AFFINE=" << affine_env << " not recognized (ai2d, ai2d_roi, cpu), using ai2d" << std::endl;
+    face_det.memory_report();
+    face_recg.memory_report();
+
+    // 与face_recognition相同的环境变量控制识别周期、检测跳帧和选帧窗口，各路独立生效
+    const char *period_env = getenv("K230_RECOGNIZE_PERIOD");
+    const char *gate_env = getenv("K230_MOTION_GATE");
+    const char *window_env = getenv("K230_QUALITY_WINDOW");
+    StreamScheduler scheduler;
+    std::vector<float> weights = stream_weights(stream_num);
+    std::vector<std::unique_ptr<CameraPipeline>> cameras;
+    for (int i = 0; i < stream_num; i++)
+    {
+        cameras.emplace_back(new CameraPipeline(i, vaddrs[i], paddrs[i], debug_mode, period_env ? atoi(period_env) : 30,
+            gate_env ? atof(gate_env) : 0.01f, window_env ? atoi(window_env) : 5, face_recg.feature_num()));
+        scheduler.add(weights[i]);
+    }
+    vector<float> embedding(face_recg.feature_num());
+
+    // 运行状态指标，各路的采集、处理计数和帧率带stream标签，由VideoStream导出
+    Metrics &metrics = Metrics::instance();
+    Gauge &inference_fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"inference\"");
+    Gauge &osd_fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"osd\"");
+    Counter &display_failed = metrics.counter("k230_display_failures_total", "Osd frames the display sink failed to show");
+    Counter &frames_skipped = metrics.counter("k230_detections_skipped_total", "Frames whose detection was skipped by the motion gate");
+    Counter &recognitions_run = metrics.counter("k230_recognitions_total", "Faces recognized by kmodel or served from the track cache", "source=\"kmodel\"");
+    Counter &recognitions_cached = metrics.counter("k230_recognitions_total", "Faces recognized by kmodel or served from the track cache", "source=\"cache\"");
+    Counter &database_searches = metrics.counter("k230_database_searches_total", "Face database searches");
+
+    // 只有第0路送显，osd线程绘制第0路的最新结果
+    LatestMailbox<vector<FaceOsdInfo>> mailbox;
+    std::thread thread_osd([&]()
+    {
+        FpsCounter fps("osd", debug_mode);
+        TraceRecorder::instance().set_thread_name("osd");
+        auto period = std::chrono::microseconds(1000000 / OSD_FPS);
+        auto next = std::chrono::steady_clock::now();
+        while (!isp_stop)
+        {
+            if (mailbox.update())
+            {
+                int osd_index;
+                {
+                    ScopedTiming st("osd draw", debug_mode);
+                    osd.begin_frame();
+                    for (auto &face : mailbox.read_slot())
+                        face_recg.draw_result(osd, face.bbox, face.recg);
+                    osd_index = osd.end_frame();
+                }
+                {
+                    // 送显（或丢弃、录制）单独计时，与绘制耗时分开
+                    ScopedTiming st("osd show", debug_mode);
+                    if (!display->show(osd_index))
+                        display_failed.inc();
+                }
+                if (fps.tick())
+                    osd_fps.set(fps.fps());
+            }
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    FpsCounter fps("inference", debug_mode);
+    TraceRecorder::instance().set_thread_name("inference");
+    while (!isp_stop)
+    {
+        ScopedTiming st("total time", 1);
+        // 各路按权重轮流占用模型，采集失败的一次调度也计入，掉线的摄像头不会占满推理
+        CameraPipeline &cam = *cameras[scheduler.next()];
+        VideoStream &stream = cam.stream;
+        {
+            ScopedTiming st("read capture", debug_mode);
+            if (!stream.capture())
+                continue;
+        }
+
+        bool infer;
+        {
+            ScopedTiming st("motion gate", debug_mode);
+            infer = cam.gate.update_rgb_planar(stream.data(), SENSOR_WIDTH, SENSOR_HEIGHT);
+        }
+        if (infer)
+        {
+            face_det.bind_isp(reinterpret_cast<uintptr_t>(stream.data()), stream.paddr());
+            face_recg.bind_isp(reinterpret_cast<uintptr_t>(stream.data()), stream.paddr());
+            cam.det_results.clear();
+            face_det.pre_process();
+            face_det.inference();
+            face_det.post_process({SENSOR_WIDTH, SENSOR_HEIGHT}, cam.det_results);
+        }
+        else
+        {
+            frames_skipped.inc();
+        }
+
+        // isp为rgb planar，g平面近似作为亮度算清晰度
+        const uint8_t *isp_luma = stream.data() + SENSOR_HEIGHT * SENSOR_WIDTH;
+        cam.results.clear();
+        for (auto &track : infer ? cam.tracker.update(cam.det_results) : cam.tracker.predict())
+        {
+            if (track.time_since_update != 0)
+                continue;
+            if (infer && cam.tracker.needs_recognition(track))
+            {
+                float sharpness = FaceQuality::sharpness(isp_luma, SENSOR_WIDTH, SENSOR_HEIGHT, SENSOR_WIDTH, track.det.bbox);
+                FaceQualityInfo quality = FaceQuality::score(track.det, sharpness);
+                if (cam.best_face.offer(track.id, quality.total))
+                {
+                    face_recg.pre_process(track.det.sparse_kps.points);
+                    face_recg.save_aligned(cam.best_face.crop(track.id));
+                }
+                if (cam.best_face.ready(track.id))
+                {
+                    face_recg.load_aligned(cam.best_face.crop(track.id));
+                    face_recg.inference();
+                    face_recg.get_embedding(embedding.data());
+
+                    FaceRecognitionInfo recg_result = {track.identity_id, track.identity_score, track.identity_name};
+                    if (cam.aggregator.add(track.id, embedding.data(), cam.best_face.best(track.id)))
+                    {
+                        face_recg.database_search(cam.aggregator.aggregate(track.id), recg_result);
+                        cam.aggregator.mark_searched(track.id);
+                        database_searches.inc();
+                    }
+                    cam.tracker.set_identity(track, recg_result.id, recg_result.score, recg_result.name);
+                    cam.best_face.finish(track.id);
+                    recognitions_run.inc();
+                }
+            }
+            else
+            {
+                recognitions_cached.inc();
+            }
+            cam.results.push_back({track.det.bbox, {track.identity_id, track.identity_score, track.identity_name}});
+        }
+        cam.best_face.retain(cam.tracker.tracks());
+        cam.aggregator.retain(cam.tracker.tracks());
+        stream.done(cam.results.size());
+
+        if (stream.id() == 0)
+        {
+            mailbox.write_slot() = cam.results;
+            mailbox.publish(stream.frame().frame_id);
+        }
+        if (fps.tick())
+            inference_fps.set(fps.fps());
+        Profiler::instance().frame();
+    }
+
+    thread_osd.join();
+    display.reset();
+    vivcap_stop_multi(stream_num);
+
+    for (int i = 0; i < stream_num; i++)
+    {
+        cout << "stream " << i << ": captured " << cameras[i]->stream.captured() << ", failed " << cameras[i]->stream.failed() << ", dropped " << cameras[i]->stream.dropped()
+             << ", processed " << cameras[i]->stream.processed() << ", scheduled " << scheduler.count(i) << endl;
+        int ret = kd_mpi_sys_mmz_free(paddrs[i], vaddrs[i]);
+        if (ret)
+        {
+            std::cerr << "free failed: ret = " << ret << ", errno = " << strerror(errno) << std::endl;
+            std::abort();
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::cout << "case " << argv[0] << " built at " << __DATE__ << " " << __TIME__ << std::endl;
+    if (argc != 10)
+    {
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    std::thread thread_isp(video_proc, argv);
+    while (getchar() != 'q')
+    {
+        usleep(10000);
+    }
+
+    isp_stop = true;
+    thread_isp.join();
+    return 0;
+}
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "utils.h"
+#include "face_detection.h"
+#include "frame_source.h"
+#include "latency_policy.h"
+#include "motion_gate.h"
+#include "metrics.h"
+#include "osd_compositor.h"
+#include "display_sink.h"
+
+static void usage(const char *prog)
+{
+    std::cerr << "Usage: " << prog << " [options] <kmodel_det> <obj_thresh> <nms_thresh> <source>" << std::endl;
+    std::cerr << "  source          raw frames back to back in one file, a printf pattern (frames/%04d.bin, one frame per file)," << std::endl;
+    std::cerr << "                  a video file (.mp4/.avi/.mkv/.mov/.h264/.h265, host build with opencv videoio) or synthetic[:seed]" << std::endl;
+    std::cerr << "  --size WxH      frame size (default 1280x720)" << std::endl;
+    std::cerr << "  --format F      rgb (rgb888 planar, default) or nv12" << std::endl;
+    std::cerr << "  --fps F         replay at F frames per second (default 0: as fast as possible; -1: video file's own rate)" << std::endl;
+    std::cerr << "  --loop N        replay the source N times, 0 for endless (default 1)" << std::endl;
+    std::cerr << "  --frames N      stop after N processed frames (default 0: until the source ends, 300 for synthetic)" << std::endl;
+    std::cerr << "  --policy P      latency policy: all (default, repeatable), newest, every:N, fps:F" << std::endl;
+    std::cerr << "  --results file  write detections per processed frame: frame_id face_num, then x y w h score per face" << std::endl;
+    std::cerr << "  --display D     draw detections on a frame-sized argb osd for every processed frame: null (draw only)," << std::endl;
+    std::cerr << "                  or a recording path (raw argb frames back to back, a printf pattern, or .avi/.mp4/.mkv on host)" << std::endl;
+}
+
+// 在与帧同尺寸的osd上画检测框、分数和关键点（图片模式没有isp尺寸，不能用FaceDetection::draw_result(osd)）
+static void draw_results(OsdCompositor &osd, const std::vector<FaceDetectionInfo> &results)
+{
+    static const cv::Scalar kps_color(0, 255, 0, 255);
+    for (auto &r : results)
+    {
+        for (int k = 0; k < 5; k++)
+            osd.circle(cv::Point(r.sparse_kps.points[2 * k], r.sparse_kps.points[2 * k + 1]), 4, kps_color, 8);
+        char text[10];
+        snprintf(text, sizeof(text), "%.2f", r.score);
+        osd.rectangle(cv::Rect(r.bbox.x, r.bbox.y, r.bbox.w, r.bbox.h), cv::Scalar(255, 255, 255, 255), 6);
+        osd.put_text(text, {(int)r.bbox.x, (int)r.bbox.y}, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(255, 0, 255, 255), 1);
+    }
+}
+
+// isp数据（rgb planar或nv12）转为图片模式预处理使用的bgr hwc
+static void isp_to_bgr(const std::vector<uint8_t> &isp, int width, int height, FrameFormat format, cv::Mat &bgr)
+{
+    if (format == FRAME_NV12)
+    {
+        cv::Mat nv12(height * 3 / 2, width, CV_8UC1, const_cast<uint8_t *>(isp.data()));
+        cv::cvtColor(nv12, bgr, cv::COLOR_YUV2BGR_NV12);
+        return;
+    }
+    size_t plane = (size_t)width * height;
+    bgr.create(height, width, CV_8UC3);
+    const uint8_t *r = isp.data();
+    const uint8_t *g = r + plane;
+    const uint8_t *b = g + plane;
+    for (int row = 0; row < height; row++)
+    {
+        uint8_t *dst = bgr.ptr<uint8_t>(row);
+        size_t offset = (size_t)row * width;
+        for (int col = 0; col < width; col++)
+        {
+            dst[3 * col] = b[offset + col];
+            dst[3 * col + 1] = g[offset + col];
+            dst[3 * col + 2] = r[offset + col];
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::cout << "case " << argv[0] << " build " << __DATE__ << " " << __TIME__ << std::endl;
+
+    int width = 1280, height = 720;
+    FrameFormat format = FRAME_RGB_PLANAR;
+    float fps = 0.f;
+    int loop = 1;
+    long max_frames = 0;
+    std::string results_file;
+    std::string display_spec;
+    LatencyPolicy policy(LATENCY_ALL);
+    std::vector<char *> args{argv[0]};
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt = argv[i];
+        bool has_value = i + 1 < argc;
+        if (opt == "--size" && has_value && sscanf(argv[i + 1], "%dx%d", &width, &height) == 2)
+            i++;
+        else if (opt == "--format" && has_value && (std::string(argv[i + 1]) == "rgb" || std::string(argv[i + 1]) == "nv12"))
+            format = std::string(argv[++i]) == "nv12" ? FRAME_NV12 : FRAME_RGB_PLANAR;
+        else if (opt == "--fps" && has_value)
+            fps = atof(argv[++i]);
+        else if (opt == "--loop" && has_value)
+            loop = atoi(argv[++i]);
+        else if (opt == "--frames" && has_value)
+            max_frames = atol(argv[++i]);
+        else if (opt == "--policy" && has_value && LatencyPolicy::parse(argv[i + 1], policy))
+            i++;
+        else if (opt == "--results" && has_value)
+            results_file = argv[++i];
+        else if (opt == "--display" && has_value)
+            display_spec = argv[++i];
+        else if (opt.compare(0, 2, "--") == 0)
+        {
+            usage(argv[0]);
+            return -1;
+        }
+        else
+            args.push_back(argv[i]);
+    }
+    if (args.size() != 5 || width <= 0 || height <= 0 || loop < 0)
+    {
+        usage(argv[0]);
+        return -1;
+    }
+    std::string source_spec = args[4];
+    if (source_spec.compare(0, 9, "synthetic") == 0 && max_frames == 0)
+        max_frames = 300;
+
+    std::unique_ptr<FrameSource> source = open_frame_source(source_spec, width, height, format, fps, loop);
+    if (!source)
+    {
+        std::cerr << "open source " << source_spec << " failed" << std::endl;
+        return -1;
+    }
+    std::cout << "source " << source->name() << " " << width << "x" << height << (format == FRAME_NV12 ? " nv12" : " rgb")
+              << ", fps " << fps << ", policy " << policy.describe() << std::endl;
+
+    std::ofstream results_out;
+    if (!results_file.empty())
+    {
+        results_out.open(results_file);
+        if (!results_out)
+        {
+            std::cerr << "open " << results_file << " failed" << std::endl;
+            return -1;
+        }
+    }
+
+    // 不送显，绘制与输出分别计时；录制的osd逐帧比较即可检查两次运行的结果是否一致
+    std::unique_ptr<DisplaySink> display;
+    std::unique_ptr<OsdCompositor> osd;
+    if (!display_spec.empty())
+    {
+        // 每个处理的帧输出一帧，录制为视频时按回放帧率写（不限速回放时为30）
+        display = open_display_sink(display_spec, width, height, 2, fps > 0 ? fps : 30.f);
+        if (!display)
+        {
+            std::cerr << "open display " << display_spec << " failed" << std::endl;
+            return -1;
+        }
+        osd.reset(new OsdCompositor(width, height, display->buffers()));
+    }
+
+    // 回放走图片模式的预处理（cpu转换+ai2d），不依赖vicap和mmz，主机、板端都能跑
+    FaceDetection fd(args[1], atof(args[2]), atof(args[3]), 0);
+    const char *gate_env = getenv("K230_MOTION_GATE");
+    MotionGate gate(gate_env ? atof(gate_env) : 0.01f);
+
+    TimingLabel total_label("total time");
+    TimingLabel read_label("read capture");
+    TimingLabel convert_label("isp to bgr");
+    TimingLabel draw_label("osd draw");
+    TimingLabel show_label("osd show");
+    std::vector<uint8_t> isp(source->frame_size());
+    cv::Mat bgr;
+    std::vector<FaceDetectionInfo> results;
+    long processed = 0, skipped = 0;
+    double age_sum_ms = 0, age_max_ms = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (max_frames == 0 || processed < max_frames)
+    {
+        ScopedTiming st(total_label, 0);
+        FrameInfo frame;
+        {
+            ScopedTiming st(read_label, 0);
+            if (!policy.next(*source, isp.data(), frame))
+                break;
+        }
+
+        // 跳帧时沿用上次的检测结果，与face_detection一致
+        bool infer = format == FRAME_NV12 ? gate.update_luma(isp.data(), width, height, width) : gate.update_rgb_planar(isp.data(), width, height);
+        if (infer)
+        {
+            {
+                ScopedTiming st(convert_label, 0);
+                isp_to_bgr(isp, width, height, format, bgr);
+            }
+            results.clear();
+            fd.pre_process(bgr);
+            fd.inference();
+            fd.post_process({width, height}, results);
+        }
+        else
+        {
+            skipped++;
+        }
+
+        if (results_out)
+        {
+            results_out << frame.frame_id << " " << results.size() << "\n";
+            for (auto &r : results)
+                results_out << r.bbox.x << " " << r.bbox.y << " " << r.bbox.w << " " << r.bbox.h << " " << r.score << "\n";
+        }
+        if (display)
+        {
+            int osd_index;
+            {
+                ScopedTiming st(draw_label, 0);
+                osd->begin_frame();
+                draw_results(*osd, results);
+                osd_index = osd->end_frame();
+            }
+            ScopedTiming st(show_label, 0);
+            display->show(osd_index);
+        }
+        double age_ms = (FrameSource::now_us() - frame.timestamp_us) / 1000.0;
+        age_sum_ms += age_ms;
+        age_max_ms = std::max(age_max_ms, age_ms);
+        processed++;
+        Profiler::instance().frame();
+    }
+    double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "processed " << processed << " frames (" << skipped << " skipped by motion gate, " << policy.dropped()
+              << " dropped by policy) in " << elapsed_s << " s, " << (elapsed_s > 0 ? processed / elapsed_s : 0) << " fps" << std::endl;
+    if (display)
+        std::cout << "display " << display->name() << ": shown " << display->shown() << ", failed " << display->failed() << std::endl;
+    if (processed)
+        std::cout << "frame age mean " << age_sum_ms / processed << " ms, max " << age_max_ms << " ms" << std::endl;
+    return processed ? 0 : -1;
+}
@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+#include <nncase/runtime/runtime_tensor.h>
+#include <nncase/runtime/interpreter.h>
+#include <nncase/runtime/runtime_op_utility.h>
+#include "binary_io.h"
+#include "nncase_dtype.h"
+#include "output_compare.h"
+
+using namespace nncase;
+using namespace nncase::runtime;
+using namespace nncase::runtime::detail;
+
+/**
+ * @brief 阈值配置，key=value格式，#开头为注释
+ *   cosine_min=0.999          对所有输出生效
+ *   output1.max_abs_max=0.5   只对输出1生效，覆盖上面的默认值
+ * 支持的key：cosine_min、max_abs_max、rmse_max、topk、topk_min
+ */
+class RegressionConfig
+{
+public:
+    RegressionConfig() {}
+
+    /**
+     * @brief 不给配置文件时的默认阈值
+     * @param text key=value文本
+     */
+    explicit RegressionConfig(const std::string &text)
+    {
+        std::istringstream iss(text);
+        parse(iss, "default");
+    }
+
+    bool load(const std::string &path)
+    {
+        std::ifstream ifs(path);
+        return ifs && parse(ifs, path);
+    }
+
+    /**
+     * @brief 第output个输出的阈值：先套用全局项，再用output<N>.xxx覆盖
+     */
+    CompareThreshold threshold(int output) const
+    {
+        CompareThreshold threshold;
+        for (auto &kv : defaults_)
+            set(threshold, kv.first, kv.second);
+        auto it = outputs_.find(output);
+        if (it != outputs_.end())
+        {
+            for (auto &kv : it->second)
+                set(threshold, kv.first, kv.second);
+        }
+        return threshold;
+    }
+
+private:
+    typedef std::vector<std::pair<std::string, double>> Entries;
+
+    bool parse(std::istream &is, const std::string &path)
+    {
+        std::string line;
+        int line_no = 0;
+        while (std::getline(is, line))
+        {
+            line_no++;
+            line.erase(std::find(line.begin(), line.end(), '#'), line.end());
+            trim(line);
+            if (line.empty())
+                continue;
+            size_t eq = line.find('=');
+            if (eq == std::string::npos)
+            {
+                std::cerr << path << ":" << line_no << ": expected key=value" << std::endl;
+                return false;
+            }
+            std::string key = line.substr(0, eq);
+            std::string value = line.substr(eq + 1);
+            trim(key);
+            trim(value);
+
+            Entries *entries = &defaults_;
+            if (key.compare(0, 6, "output") == 0)
+            {
+                size_t dot = key.find('.');
+                if (dot == std::string::npos)
+                {
+                    std::cerr << path << ":" << line_no << ": expected output<N>.<key>" << std::endl;
+                    return false;
+                }
+                entries = &outputs_[atoi(key.c_str() + 6)];
+                key = key.substr(dot + 1);
+            }
+            CompareThreshold probe;
+            if (!set(probe, key, 0))
+            {
+                std::cerr << path << ":" << line_no << ": unknown key " << key << std::endl;
+                return false;
+            }
+            entries->push_back({key, atof(value.c_str())});
+        }
+        return true;
+    }
+
+    static void trim(std::string &s)
+    {
+        size_t begin = s.find_first_not_of(" \t\r");
+        size_t end = s.find_last_not_of(" \t\r");
+        s = begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+    }
+
+    static bool set(CompareThreshold &threshold, const std::string &key, double value)
+    {
+        if (key == "cosine_min")
+            threshold.cosine_min = value;
+        else if (key == "max_abs_max")
+            threshold.max_abs_max = value;
+        else if (key == "rmse_max")
+            threshold.rmse_max = value;
+        else if (key == "topk")
+            threshold.topk = (int)value;
+        else if (key == "topk_min")
+            threshold.topk_min = value;
+        else
+            return false;
+        return true;
+    }
+
+    Entries defaults_;
+    std::map<int, Entries> outputs_;
+};
+
+static bool is_file(const std::string &path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+// 测试向量目录下的每个子目录是一个case，按名字排序
+static std::vector<std::string> list_cases(const std::string &dir)
+{
+    std::vector<std::string> cases;
+    DIR *d = opendir(dir.c_str());
+    if (!d)
+        return cases;
+    while (struct dirent *entry = readdir(d))
+    {
+        std::string name = entry->d_name;
+        if (name == "." || name == "..")
+            continue;
+        struct stat st;
+        if (stat((dir + "/" + name).c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+            cases.push_back(name);
+    }
+    closedir(d);
+    std::sort(cases.begin(), cases.end());
+    return cases;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point stop)
+{
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+static void usage(const char *prog)
+{
+    std::cerr << "Usage: " << prog << " [--config regression.cfg] [--loop N] <kmodel> <vector_dir>" << std::endl;
+    std::cerr << "  vector_dir/<case>/input_<i>.bin   inputs of each case, size must match the input tensor" << std::endl;
+    std::cerr << "  vector_dir/<case>/output_<i>.bin  expected outputs (simulator results), missing ones are skipped" << std::endl;
+    std::cerr << "  --config file  thresholds, key=value (default vector_dir/regression.cfg, cosine_min=0.99 if absent)" << std::endl;
+    std::cerr << "  --loop N       run all cases N times, for throughput (default 1)" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::cout << "case " << argv[0] << " build " << __DATE__ << " " << __TIME__ << std::endl;
+
+    std::string config_file;
+    int loop = 1;
+    std::vector<char *> args{argv[0]};
+    for (int i = 1; i < argc; i++)
+    {
+        std::string opt = argv[i];
+        if (opt == "--config" && i + 1 < argc)
+            config_file = argv[++i];
+        else if (opt == "--loop" && i + 1 < argc)
+            loop = atoi(argv[++i]);
+        else if (opt.compare(0, 2, "--") == 0)
+        {
+            usage(argv[0]);
+            return -1;
+        }
+        else
+            args.push_back(argv[i]);
+    }
+    if (args.size() != 3 || loop < 1)
+    {
+        usage(argv[0]);
+        return -1;
+    }
+    std::string kmodel = args[1];
+    std::string vector_dir = args[2];
+
+    RegressionConfig config("cosine_min=0.99");
+    if (config_file.empty() && is_file(vector_dir + "/regression.cfg"))
+        config_file = vector_dir + "/regression.cfg";
+    if (config_file.empty())
+        std::cout << "no config, default cosine_min=0.99" << std::endl;
+    else
+    {
+        config = RegressionConfig();
+        if (!config.load(config_file))
+        {
+            std::cerr << "load config " << config_file << " failed" << std::endl;
+            return -1;
+        }
+    }
+
+    std::vector<std::string> cases = list_cases(vector_dir);
+    if (cases.empty())
+    {
+        std::cerr << "no case found in " << vector_dir << std::endl;
+        return -1;
+    }
+
+    // 1. 模型只加载一次，输入输出tensor只创建一次，所有case复用
+    interpreter interp;
+    std::ifstream ifs(kmodel, std::ios::binary);
+    interp.load_model(ifs).expect("Invalid kmodel");
+
+    std::vector<runtime_tensor> inputs;
+    for (size_t i = 0; i < interp.inputs_size(); i++)
+    {
+        auto tensor = host_runtime_tensor::create(interp.input_desc(i).datatype, interp.input_shape(i), hrt::pool_shared).expect("cannot create input tensor");
+        interp.input_tensor(i, tensor).expect("cannot set input tensor");
+        inputs.push_back(tensor);
+    }
+
+    std::vector<TensorDType> output_dtypes;
+    std::vector<CompareThreshold> thresholds;
+    for (size_t i = 0; i < interp.outputs_size(); i++)
+    {
+        auto desc = interp.output_desc(i);
+        auto tensor = host_runtime_tensor::create(desc.datatype, interp.output_shape(i), hrt::pool_shared).expect("cannot create output tensor");
+        interp.output_tensor(i, tensor).expect("cannot set output tensor");
+
+        // 不支持的类型（boolean等）按uint8逐字节比较
+        TensorDType dtype = DT_UINT8;
+        if (!to_tensor_dtype(desc.datatype, dtype))
+            std::cout << "output " << i << ": unsupported dtype, compared as uint8" << std::endl;
+        output_dtypes.push_back(dtype);
+
+        CompareThreshold threshold = config.threshold((int)i);
+        thresholds.push_back(threshold);
+        std::cout << "output " << i << ": " << OutputCompare::dtype_name(dtype) << ", cosine_min " << threshold.cosine_min << ", max_abs_max "
+                  << threshold.max_abs_max << ", rmse_max " << threshold.rmse_max << ", top" << threshold.topk << "_min " << threshold.topk_min << std::endl;
+    }
+
+    // 2. 逐个case：读输入、run、与期望输出比较
+    int passed = 0, failed = 0, runs = 0;
+    double run_total_ms = 0;
+    auto wall_start = std::chrono::steady_clock::now();
+    for (int l = 0; l < loop; l++)
+    {
+        for (auto &name : cases)
+        {
+            std::string case_dir = vector_dir + "/" + name;
+            bool ok = true;
+            for (size_t i = 0; i < inputs.size() && ok; i++)
+            {
+                std::string path = case_dir + "/input_" + std::to_string(i) + ".bin";
+                auto mapped_buf = std::move(hrt::map(inputs[i], map_access_::map_write).unwrap());
+                if (!BinaryIO::read_exact(path.c_str(), mapped_buf.buffer().data(), mapped_buf.buffer().size_bytes()))
+                {
+                    std::cerr << name << ": load " << path << " failed" << std::endl;
+                    ok = false;
+                }
+                mapped_buf.unmap().expect("unmap input failed");
+                hrt::sync(inputs[i], sync_op_t::sync_write_back, true).expect("sync write_back failed");
+            }
+            if (!ok)
+            {
+                failed += l == 0;
+                continue;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            interp.run().expect("error occurred in running model");
+            run_total_ms += elapsed_ms(start, std::chrono::steady_clock::now());
+            runs++;
+
+            // 多次循环只在第一轮比较，后面的轮次只用于测吞吐
+            if (l > 0)
+                continue;
+
+            for (size_t i = 0; i < interp.outputs_size(); i++)
+            {
+                std::string path = case_dir + "/output_" + std::to_string(i) + ".bin";
+                if (!is_file(path))
+                    continue;
+                auto out = interp.output_tensor(i).expect("cannot get output tensor");
+                auto mapped_buf = std::move(hrt::map(out, map_access_::map_read).unwrap());
+                MappedFile expected(path.c_str());
+                if (!expected.is_open() || expected.size() != mapped_buf.buffer().size_bytes())
+                {
+                    std::cerr << name << " output " << i << " Fail: expected file size " << expected.size() << " != output size " << mapped_buf.buffer().size_bytes() << std::endl;
+                    ok = false;
+                    continue;
+                }
+
+                const CompareThreshold &threshold = thresholds[i];
+                CompareResult result = OutputCompare::compare(mapped_buf.buffer().data(), expected.data(), expected.size(), output_dtypes[i], threshold.topk);
+                std::string reason;
+                bool pass = OutputCompare::check(result, threshold, reason);
+                printf("%s output %zu %s: cosine %.6f, max_abs %.6g, rmse %.6g", name.c_str(), i, pass ? "Pass" : "Fail", result.cosine, result.max_abs, result.rmse);
+                if (result.topk_agreement >= 0)
+                    printf(", top%d %.3f", threshold.topk, result.topk_agreement);
+                printf("%s%s\n", pass ? "" : "  <- ", reason.c_str());
+                ok = ok && pass;
+            }
+            if (ok)
+                passed++;
+            else
+                failed++;
+        }
+    }
+    double wall_ms = elapsed_ms(wall_start, std::chrono::steady_clock::now());
+
+    // 3. 汇总：吞吐包含读输入文件和比较，interp run单独统计
+    printf("cases %zu, passed %d, failed %d\n", cases.size(), passed, failed);
+    printf("runs %d in %.1f ms: %.2f cases/s, interp run mean %.3f ms\n", runs, wall_ms, runs * 1000.0 / wall_ms, runs ? run_total_ms / runs : 0.0);
+    return failed ? 1 : 0;
+}
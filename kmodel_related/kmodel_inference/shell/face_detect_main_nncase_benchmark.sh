@@ -0,0 +1,5 @@
+#!/bin/bash
+# 用法：./face_detect_main_nncase_benchmark.sh [kmodel]，默认face_detect_640.kmodel
+# 对比不同nncase版本、量化方式（如build_model_int16.sh生成的kmodel）时传入对应kmodel，结果写到<kmodel>.benchmark.json
+kmodel=${1:-face_detect_640.kmodel}
+./main_nncase.elf --warmup 10 --repeat 100 --time-io --json ${kmodel%.kmodel}.benchmark.json ${kmodel} face_det_0_640x640_uint8.bin face_det_0_k230_simu.bin face_det_1_k230_simu.bin face_det_2_k230_simu.bin
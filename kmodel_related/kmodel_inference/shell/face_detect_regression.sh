@@ -0,0 +1,17 @@
+#!/bin/bash
+# 用法：./face_detect_regression.sh [kmodel]，默认face_detect_640.kmodel
+# 把simulator生成的测试向量整理成regression.elf的目录结构：regression/<case>/input_<i>.bin、output_<i>.bin
+kmodel=${1:-face_detect_640.kmodel}
+mkdir -p regression/face_det_0
+cp face_det_0_640x640_uint8.bin regression/face_det_0/input_0.bin
+cp face_det_0_k230_simu.bin regression/face_det_0/output_0.bin
+cp face_det_1_k230_simu.bin regression/face_det_0/output_1.bin
+cp face_det_2_k230_simu.bin regression/face_det_0/output_2.bin
+cat > regression/regression.cfg <<CFG
+# 所有输出
+cosine_min = 0.999
+# output0为人脸框回归，output1为人脸置信度，output2为关键点
+output1.topk = 16
+output1.topk_min = 0.9
+CFG
+./regression.elf --loop 100 ${kmodel} regression
@@ -0,0 +1,5 @@
+#!/bin/bash
+# 用法：./face_recognize_main_nncase_benchmark.sh [kmodel]，默认face_recognize.kmodel
+# 对比不同nncase版本、量化方式（如build_model_int16.sh生成的kmodel）时传入对应kmodel，结果写到<kmodel>.benchmark.json
+kmodel=${1:-face_recognize.kmodel}
+./main_nncase.elf --warmup 10 --repeat 100 --time-io --json ${kmodel%.kmodel}.benchmark.json ${kmodel} face_recg_0_112x112_uint8.bin face_recg_0_k230_simu.bin
@@ -0,0 +1,2 @@
+#!/bin/bash
+./multi_camera.elf face_detect_640.kmodel 0.6 0.2 face_recognize.kmodel 100 75 2 0 ../face_recognize/db
\ No newline at end of file
@@ -1,105 +0,0 @@
-/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- * 1. Redistributions of source code must retain the above copyright
- * notice, this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- * notice, this list of conditions and the following disclaimer in the
- * documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
- * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
- * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
- * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
- * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
- * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
- * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
- * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-// ai_base.h
-#ifndef AI_BASE_H
-#define AI_BASE_H
-
-#include <vector>
-#include <string>
-#include <fstream>
-
-#include <nncase/runtime/interpreter.h>
-#include "scoped_timing.hpp"
-#include "utils.h"
-
-using std::string;
-using std::vector;
-using namespace nncase::runtime;
-
-/**
- * @brief AI基类，封装nncase相关操作
- * 主要封装了nncase的加载、设置输入、运行、获取输出操作，后续开发demo只需要关注模型的前处理、后处理即可
- */
-class AIBase
-{
-public:
-    /**
-     * @brief AI基类构造函数，加载kmodel,并初始化kmodel输入、输出
-     * @param kmodel_file kmodel文件路径
-     * @param debug_mode  0（不调试）、 1（只显示时间）、2（显示所有打印信息）
-     * @return None
-     */
-    AIBase(const char *kmodel_file,const string model_name, const int debug_mode = 1);
-
-    /**
-     * @brief AI基类析构函数
-     * @return None
-     */
-    ~AIBase();
-
-    /**
-     * @brief 根据索引获取kmodel输入tensor
-     * @param idx 输入数据指针
-     * @return None
-     */
-    runtime_tensor get_input_tensor(size_t idx);
-
-    /**
-     * @brief 推理kmodel
-     * @return None
-     */
-    void run();
-
-    /**
-     * @brief 获取kmodel输出，结果保存在对应的类属性中
-     * @return None
-     */
-    void get_output();
-
-protected:
-    string model_name_;                    // 模型名字
-    int debug_mode_;                       // 调试模型，0（不打印），1（打印时间），2（打印所有）
-    vector<float *> p_outputs_;            // kmodel输出对应的指针列表
-    vector<vector<int>> input_shapes_;     //{{N,C,H,W},{N,C,H,W}...}
-    vector<vector<int>> output_shapes_;    //{{N,C,H,W},{N,C,H,W}...}} 或 {{N,C},{N,C}...}}等
-    vector<int> each_input_size_by_byte_;  //{0,layer1_length,layer1_length+layer2_length,...}
-    vector<int> each_output_size_by_byte_; //{0,layer1_length,layer1_length+layer2_length,...}
-private:
-    /**
-     * @brief 首次初始化kmodel输入，并获取输入shape
-     * @return None
-     */
-    void set_input_init();
-
-    /**
-     * @brief 首次初始化kmodel输出，并获取输出shape
-     * @return None
-     */
-    void set_output_init();
-
-    interpreter kmodel_interp_;        // kmodel解释器，从kmodel文件构建，负责模型的加载、输入输出设置和推理
-    vector<unsigned char> kmodel_vec_; // 通过读取kmodel文件得到整个kmodel数据，用于传给kmodel解释器加载kmodel
-};
-#endif
\ No newline at end of file
@@ -24,6 +24,7 @@
  */
 #include "ai_demo.h"
 #include "k230_math.h"
+#include "binary_io.h"
 
 // for image
 AIDemo::AIDemo(const char *kmodel_file, const int debug_mode) : AIBase(kmodel_file,"AIDemo", debug_mode)
@@ -37,23 +38,18 @@ AIDemo::AIDemo(const char *kmodel_file, const int debug_mode) : AIBase(kmodel_fi
     }
 }
 
-void AIDemo::read_binary_file(const char *file_name, char *buffer)
-{
-    std::ifstream ifs(file_name, std::ios::binary);
-    ifs.seekg(0, ifs.end);
-    size_t len = ifs.tellg();
-    ifs.seekg(0, ifs.beg);
-    ifs.read(buffer, len);
-    ifs.close();
-}
-
 void AIDemo::pre_process(char *argv[])
 {
     // need to implement oneself
     for (int i = 0 ;i<input_shapes_.size(); ++i)
     {
         auto in_buf = input_tensors_[i].impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-        read_binary_file(argv[i+2], reinterpret_cast<char *>(in_buf.data()));
+        // 直接读到输入tensor，文件大小必须与tensor一致
+        if (!BinaryIO::read_exact(argv[i+2], in_buf.data(), in_buf.size_bytes()))
+        {
+            std::cerr << "load input " << i << " failed" << std::endl;
+            std::abort();
+        }
         hrt::sync(input_tensors_[i], sync_op_t::sync_write_back, true).expect("sync write_back failed");
     }
     
@@ -71,7 +67,14 @@ void AIDemo::post_process(char *argv[])
     int start_out_index = 2 + input_shapes_.size();    //2 for elf and kmodel
     for (int i = 0; i<p_outputs_.size(); ++i)
     {
-        auto expected = Utils::read_binary_file<unsigned char>(argv[start_out_index + i]);
+        MappedFile expected(argv[start_out_index + i]);
+        size_t output_size = each_output_size_by_byte_[i + 1] - each_output_size_by_byte_[i];
+        if (!expected.is_open() || expected.size() != output_size)
+        {
+            std::cerr << "compare output " << i << " Fail: expected file size " << expected.size() << " != output size " << output_size << std::endl;
+            continue;
+        }
+
         int ret = memcmp((void *)p_outputs_[i], (void *)expected.data(), expected.size());
         if (!ret)
         {
@@ -79,7 +82,7 @@ void AIDemo::post_process(char *argv[])
         }
         else
         {
-            auto cos = cosine((const float *)p_outputs_[i], (const float *)expected.data(), expected.size()/sizeof(float));
+            auto cos = cosine((const float *)p_outputs_[i], expected.as<float>(), expected.size()/sizeof(float));
             std::cerr << "compare output " << i << " Fail: cosine similarity = " << cos << std::endl;
         }
     }
@@ -79,14 +79,6 @@ public:
     void post_process(char *argv[]);
 
 private:
-    /**
-     * @brief 读取二进制文件，并将文件内容拷贝到buffer
-     * @param file_name 文件名称
-     * @param buffer 数据保存地址
-     * @return None
-     */
-    void read_binary_file(const char *file_name, char *buffer);
-
     /**
      * @brief 向量乘
      * @param v1 向量1
@@ -0,0 +1,99 @@
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include "binary_io.h"
+#include "scoped_timing.hpp"
+
+using std::cout;
+using std::endl;
+
+#define FILE_SIZE (16 * 1024 * 1024 + 123)   // 故意不按4096对齐，覆盖O_DIRECT尾部路径
+#define LOOP_NUM (5)
+
+// 原Utils::read_binary_file的实现：seekg/tellg + 先清零的vector
+static std::vector<char> read_by_ifstream(const char *file_name)
+{
+    std::ifstream ifs(file_name, std::ios::binary);
+    ifs.seekg(0, ifs.end);
+    size_t len = ifs.tellg();
+    std::vector<char> vec(len, 0);
+    ifs.seekg(0, ifs.beg);
+    ifs.read(vec.data(), len);
+    ifs.close();
+    return vec;
+}
+
+static void check(const char *info, bool ok)
+{
+    cout << info << ": " << (ok ? "Pass!" : "Fail!") << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    // 用法：test_binary_io.elf [file]，不指定时在当前目录生成测试文件
+    const char *file_name = argc > 1 ? argv[1] : "test_binary_io.bin";
+    if (argc <= 1)
+    {
+        std::vector<char> data(FILE_SIZE);
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = (char)(i * 131 + (i >> 12));
+        std::ofstream ofs(file_name, std::ios::binary);
+        ofs.write(data.data(), data.size());
+    }
+
+    size_t len = 0;
+    if (!BinaryIO::file_size(file_name, len))
+        return -1;
+    std::vector<char> ref = read_by_ifstream(file_name);
+
+    // O_DIRECT要求目标地址对齐，这里按tensor buffer的情况用页对齐内存
+    void *dst = nullptr;
+    if (posix_memalign(&dst, 4096, len + 4096) != 0)
+        return -1;
+
+    {
+        ScopedTiming st("ifstream seekg/tellg/read x5", 1);
+        for (int i = 0; i < LOOP_NUM; ++i)
+            ref = read_by_ifstream(file_name);
+    }
+
+    const char *hint_names[] = {"READ_DEFAULT", "READ_SEQUENTIAL", "READ_DIRECT"};
+    for (int hint = READ_DEFAULT; hint <= READ_DIRECT; ++hint)
+    {
+        size_t read_size = 0;
+        bool ok = true;
+        {
+            ScopedTiming st(std::string("read_into ") + hint_names[hint] + " x5", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+                ok &= BinaryIO::read_into(file_name, dst, len + 4096, read_size, (ReadHint)hint);
+        }
+        check(hint_names[hint], ok && read_size == len && memcmp(dst, ref.data(), len) == 0);
+    }
+
+    {
+        bool ok = true;
+        {
+            ScopedTiming st("MappedFile open+memcpy x5", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+            {
+                MappedFile file(file_name);
+                ok &= file.is_open() && file.size() == len;
+                if (ok)
+                    memcpy(dst, file.data(), file.size());
+            }
+        }
+        check("MappedFile", ok && memcmp(dst, ref.data(), len) == 0);
+    }
+
+    // 错误路径：文件不存在、buffer不够大、大小不一致
+    size_t read_size;
+    std::vector<float> vec;
+    check("missing file", !BinaryIO::read_into("not_exist.bin", dst, len, read_size) && !MappedFile("not_exist.bin").is_open());
+    check("buffer too small", !BinaryIO::read_into(file_name, dst, len - 1, read_size));
+    check("size mismatch", !BinaryIO::read_exact(file_name, dst, len + 1));
+    check("element size mismatch", !BinaryIO::read_vector<float>(file_name, vec));
+
+    free(dst);
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <unistd.h>
+#include "display_sink.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+static const int kWidth = 320;
+static const int kHeight = 180;
+static const int kFrames = 6;
+
+static std::vector<uint8_t> read_file(const std::string &name)
+{
+    std::ifstream ifs(name, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+// 模拟osd线程：第i帧画在第i%2块buffer上（内容只由帧号决定），然后输出
+static std::vector<std::vector<uint8_t>> play(DisplaySink &sink, int frames)
+{
+    std::vector<std::vector<uint8_t>> shown;
+    for (int i = 0; i < frames; i++)
+    {
+        int index = i % sink.buffers().size();
+        uint8_t *buffer = reinterpret_cast<uint8_t *>(sink.buffers()[index]);
+        memset(buffer, 0, sink.frame_size());
+        // 一个随帧号移动的不透明方块
+        for (int y = 10; y < 50; y++)
+            for (int x = 10 + 20 * i; x < 50 + 20 * i; x++)
+                memset(buffer + ((size_t)y * sink.width() + x) * 4, 0xff, 4);
+        shown.emplace_back(buffer, buffer + sink.frame_size());
+        sink.show(index);
+    }
+    return shown;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string dir = argc > 1 ? argv[1] : "/tmp";
+
+    // 1. 丢弃输出：buffer可写，show只计数，越界的序号算失败
+    NullDisplaySink null_sink(kWidth, kHeight, 2);
+    check(null_sink.buffers().size() == 2 && null_sink.buffers()[0] != null_sink.buffers()[1], "two osd buffers");
+    check(null_sink.frame_size() == (size_t)kWidth * kHeight * 4, "argb frame size");
+    play(null_sink, kFrames);
+    check(null_sink.shown() == kFrames && null_sink.failed() == 0, "null sink counts frames");
+    check(!null_sink.show(2) && null_sink.failed() == 1, "bad buffer index fails");
+
+    // 2. 录制到一个文件：按顺序首尾相接，内容与画的一致
+    std::string file = dir + "/test_display_sink.argb";
+    std::vector<std::vector<uint8_t>> expected;
+    {
+        RecordingDisplaySink record(file, kWidth, kHeight, 2);
+        check(record.is_open(), "open recording");
+        expected = play(record, kFrames);
+        check(record.shown() == kFrames, "recording counts frames");
+    }
+    std::vector<uint8_t> recorded = read_file(file);
+    check(recorded.size() == kFrames * expected[0].size(), "recording size");
+    bool same = recorded.size() == kFrames * expected[0].size();
+    for (int i = 0; same && i < kFrames; i++)
+        same = memcmp(recorded.data() + i * expected[i].size(), expected[i].data(), expected[i].size()) == 0;
+    check(same, "recording content");
+
+    // 3. 同样的输入录制两次，文件逐字节相同
+    std::string again = dir + "/test_display_sink_again.argb";
+    {
+        std::unique_ptr<DisplaySink> sink = open_display_sink(again, kWidth, kHeight);
+        check(sink && std::string(sink->name()) == "record", "open recording by spec");
+        if (sink)
+            play(*sink, kFrames);
+    }
+    check(read_file(again) == recorded, "repeated recordings identical");
+
+    // 4. 逐帧文件，从0开始编号
+    std::string pattern = dir + "/test_display_sink_%02d.argb";
+    {
+        RecordingDisplaySink record(pattern, kWidth, kHeight, 2);
+        play(record, kFrames);
+    }
+    char name[256];
+    snprintf(name, sizeof(name), pattern.c_str(), kFrames - 1);
+    check(read_file(name) == expected.back(), "per-frame recording");
+
+    // 5. 按描述打开
+    std::unique_ptr<DisplaySink> null_spec = open_display_sink("null", kWidth, kHeight);
+    check(null_spec && std::string(null_spec->name()) == "null", "open null by spec");
+    check(open_display_sink(dir + "/no_such_dir/osd.argb", kWidth, kHeight) == nullptr, "unwritable path");
+#if !K230_VIDEO_FILE_SOURCE
+    check(open_display_sink(dir + "/osd.mp4", kWidth, kHeight) == nullptr, "video recording needs videoio");
+#endif
+
+    // 6. 输出开销：丢弃与录制各输出100帧
+    const int kRepeat = 100;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepeat; i++)
+        null_sink.show(i % 2);
+    double null_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    {
+        RecordingDisplaySink record(file, kWidth, kHeight, 2);
+        for (int i = 0; i < kRepeat; i++)
+            record.show(i % 2);
+    }
+    double record_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    cout << kRepeat << " frames: null " << null_ms << " ms, record " << record_ms << " ms" << endl;
+
+    unlink(file.c_str());
+    unlink(again.c_str());
+    for (int i = 0; i < kFrames; i++)
+    {
+        snprintf(name, sizeof(name), pattern.c_str(), i);
+        unlink(name);
+    }
+
+    cout << (g_ret ? "test_display_sink failed" : "test_display_sink passed") << endl;
+    return g_ret;
+}
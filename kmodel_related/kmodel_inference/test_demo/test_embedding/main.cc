@@ -0,0 +1,180 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "embedding_aggregator.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+static const int kDim = 512;
+
+static void normalize(std::vector<float> &v)
+{
+    float norm = 0;
+    for (float x : v)
+        norm += x * x;
+    norm = std::sqrt(norm);
+    for (float &x : v)
+        x /= norm;
+}
+
+static float dot(const float *a, const float *b)
+{
+    float sum = 0;
+    for (int i = 0; i < kDim; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+static std::vector<float> random_unit(std::mt19937 &rng)
+{
+    std::normal_distribution<float> dist(0.f, 1.f);
+    std::vector<float> v(kDim);
+    for (float &x : v)
+        x = dist(rng);
+    normalize(v);
+    return v;
+}
+
+// 单帧特征：真实特征加各向同性噪声后归一化，noise为噪声向量的范数
+static std::vector<float> noisy(const std::vector<float> &truth, float noise, std::mt19937 &rng)
+{
+    std::vector<float> n = random_unit(rng);
+    std::vector<float> v(kDim);
+    for (int i = 0; i < kDim; i++)
+        v[i] = truth[i] + noise * n[i];
+    normalize(v);
+    return v;
+}
+
+// 单帧特征：除各向同性噪声外，光照、角度变化会让特征在A、B之间来回偏（pull为偏向B的程度）
+static std::vector<float> confusable(const std::vector<float> &a, const std::vector<float> &b, std::mt19937 &rng)
+{
+    std::normal_distribution<float> pull(0.f, 0.6f);
+    std::vector<float> v = noisy(a, 0.8f, rng);
+    float g = pull(rng);
+    for (int i = 0; i < kDim; i++)
+        v[i] += g * (b[i] - a[i]);
+    normalize(v);
+    return v;
+}
+
+// 数据库中余弦最大的人
+static int search(const std::vector<std::vector<float>> &gallery, const float *embedding)
+{
+    int best = -1;
+    float best_cos = -2;
+    for (size_t i = 0; i < gallery.size(); i++)
+    {
+        float c = dot(gallery[i].data(), embedding);
+        if (c > best_cos)
+        {
+            best_cos = c;
+            best = i;
+        }
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    std::mt19937 rng(2024);
+
+    // 数据库：A，以及与A相像的B（cos约0.75）
+    std::vector<float> a = random_unit(rng);
+    std::vector<float> b = noisy(a, 0.85f, rng);
+    std::vector<std::vector<float>> gallery = {a, b, random_unit(rng)};
+    cout << "gallery cos(A, B) = " << dot(a.data(), b.data()) << endl;
+
+    // 1. 轨迹是A，单帧特征噪声大：逐帧查询会在A/B之间跳变，聚合后稳定
+    EmbeddingAggregator aggregator(kDim);
+    int per_frame_flips = 0, aggregate_flips = 0, per_frame_last = -1, aggregate_last = -1, searches = 0, wrong_after_warmup = 0;
+    const int frames = 200;
+    for (int f = 0; f < frames; f++)
+    {
+        std::vector<float> e = confusable(a, b, rng);
+        int id = search(gallery, e.data());
+        per_frame_flips += per_frame_last >= 0 && id != per_frame_last;
+        per_frame_last = id;
+
+        if (aggregator.add(1, e.data()))
+        {
+            int now = search(gallery, aggregator.aggregate(1));
+            aggregate_flips += aggregate_last >= 0 && now != aggregate_last;
+            aggregate_last = now;
+            aggregator.mark_searched(1);
+            searches++;
+        }
+        wrong_after_warmup += f >= 10 && aggregate_last != 0;
+    }
+    float cos_single = dot(confusable(a, b, rng).data(), a.data());
+    float cos_aggregate = dot(aggregator.aggregate(1), a.data());
+    cout << "per-frame search: " << frames << " searches, " << per_frame_flips << " identity flips" << endl;
+    cout << "aggregated: " << searches << " searches, " << aggregate_flips << " identity flips, cos to truth " << cos_aggregate << " (single frame " << cos_single << ")" << endl;
+    check(cos_aggregate > cos_single + 0.1f, "aggregate closer to the true embedding");
+    check(per_frame_flips > 10 && aggregate_flips <= 1 && wrong_after_warmup == 0, "aggregate removes flicker");
+    check(searches < frames / 4, "gallery searched only when the aggregate drifts");
+    check(aggregator.count(1) == frames, "count");
+
+    // 2. 轨迹换人（跟踪串ID）：权重封顶后平均特征能跟上，触发重新查询并得到B
+    int switched_at = -1;
+    for (int f = 0; f < 50 && switched_at < 0; f++)
+    {
+        std::vector<float> e = noisy(b, 0.3f, rng);
+        if (aggregator.add(1, e.data()))
+        {
+            if (search(gallery, aggregator.aggregate(1)) == 1)
+                switched_at = f;
+            aggregator.mark_searched(1);
+        }
+    }
+    cout << "identity change detected after " << switched_at << " frames" << endl;
+    check(switched_at >= 0 && switched_at < 30, "follows an identity change");
+
+    // 3. 权重：高质量帧占比更大
+    EmbeddingAggregator weighted(kDim);
+    weighted.add(1, a.data(), 0.1f);
+    weighted.add(1, b.data(), 0.9f);
+    check(dot(weighted.aggregate(1), b.data()) > dot(weighted.aggregate(1), a.data()), "quality weighting");
+
+    // 4. 固定容量：满了淘汰最久未更新的，retain释放消失的轨迹
+    EmbeddingAggregator small(kDim, 2);
+    small.add(1, a.data());
+    small.add(2, a.data());
+    small.add(1, a.data());
+    small.add(3, b.data());
+    check(small.aggregate(1) && !small.aggregate(2) && small.aggregate(3), "evicts least recently updated");
+    FaceTracker tracker;
+    std::vector<FaceTrack> tracks = tracker.update({FaceDetectionInfo{{0, 0, 10, 10}, {{0}}, 0.9f}});
+    tracks[0].id = 3;
+    small.retain(tracks);
+    check(!small.aggregate(1) && small.aggregate(3), "retain frees lost tracks");
+    small.reset();
+    check(!small.aggregate(3) && small.count(3) == 0, "reset");
+
+    // 5. 耗时：512维每帧一次add
+    EmbeddingAggregator bench(kDim);
+    std::vector<float> e = noisy(a, 1.0f, rng);
+    const int loops = 100000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++)
+        bench.add(i % 8, e.data());
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / loops;
+    cout << "add: " << us << " us" << endl;
+
+    cout << (g_ret ? "test_embedding failed" : "test_embedding passed") << endl;
+    return g_ret;
+}
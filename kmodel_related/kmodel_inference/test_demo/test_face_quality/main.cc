@@ -0,0 +1,126 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "face_quality.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+// 以框为基准的五官点：正脸为左眼(0.3,0.4)、右眼(0.7,0.4)、鼻尖(0.5,0.6)、嘴角(0.35,0.8)(0.65,0.8)，yaw为鼻尖水平偏移（框宽比例）
+static FaceDetectionInfo make_face(float x, float y, float size, float score, float yaw = 0, float roll_dy = 0)
+{
+    FaceDetectionInfo det;
+    det.bbox = {x, y, size, size};
+    const float rel[10] = {0.3f, 0.4f, 0.7f, 0.4f, 0.5f + yaw, 0.6f, 0.35f, 0.8f, 0.65f, 0.8f};
+    for (int i = 0; i < 10; i++)
+        det.sparse_kps.points[i] = (i % 2 ? y : x) + rel[i] * size;
+    det.sparse_kps.points[3] += roll_dy * size;
+    det.score = score;
+    return det;
+}
+
+static const int kWidth = 640;
+static const int kHeight = 480;
+
+// 亮度图：左半边细纹理（清晰），右半边平滑渐变（模糊）
+static std::vector<uint8_t> make_luma()
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> texture(0, 255);
+    std::vector<uint8_t> y((size_t)kWidth * kHeight);
+    for (int r = 0; r < kHeight; r++)
+        for (int c = 0; c < kWidth; c++)
+            y[(size_t)r * kWidth + c] = c < kWidth / 2 ? texture(rng) : (uint8_t)(c / 4 + r / 8);
+    return y;
+}
+
+int main(int argc, char *argv[])
+{
+    // 1. 正脸程度
+    float straight = FaceQuality::frontal(make_face(100, 100, 120, 0.9f).sparse_kps);
+    float half_turn = FaceQuality::frontal(make_face(100, 100, 120, 0.9f, 0.1f).sparse_kps);
+    float profile = FaceQuality::frontal(make_face(100, 100, 120, 0.9f, 0.25f).sparse_kps);
+    float tilted = FaceQuality::frontal(make_face(100, 100, 120, 0.9f, 0, 0.2f).sparse_kps);
+    cout << "frontal: straight " << straight << ", yaw " << half_turn << ", profile " << profile << ", roll " << tilted << endl;
+    check(straight > 0.95f, "straight face is frontal");
+    check(half_turn < straight && profile < half_turn && profile < 0.05f, "yaw lowers frontal");
+    check(tilted < 0.5f, "roll lowers frontal");
+
+    // 2. 清晰度
+    std::vector<uint8_t> luma = make_luma();
+    float sharp = FaceQuality::sharpness(luma.data(), kWidth, kHeight, kWidth, {50, 100, 150, 150});
+    float blurred = FaceQuality::sharpness(luma.data(), kWidth, kHeight, kWidth, {400, 100, 150, 150});
+    float outside = FaceQuality::sharpness(luma.data(), kWidth, kHeight, kWidth, {700, 100, 50, 50});
+    cout << "sharpness: textured " << sharp << ", smooth " << blurred << endl;
+    check(sharp > 0.9f && blurred < 0.1f, "sharpness separates texture from blur");
+    check(outside == 0, "bbox outside frame");
+    check(FaceQuality::sharpness(luma.data(), kWidth, kHeight, kWidth, {-20, -20, 60, 60}) > 0, "bbox clipped to frame");
+
+    // 3. 综合质量：大、正、清晰的脸最好
+    FaceQualityInfo best = FaceQuality::score(make_face(50, 100, 150, 0.95f), sharp);
+    FaceQualityInfo small = FaceQuality::score(make_face(50, 100, 40, 0.95f), sharp);
+    FaceQualityInfo side = FaceQuality::score(make_face(50, 100, 150, 0.95f, 0.2f), sharp);
+    FaceQualityInfo blur = FaceQuality::score(make_face(400, 100, 150, 0.95f), blurred);
+    cout << "quality: best " << best.total << ", small " << small.total << ", side " << side.total << ", blurred " << blur.total << endl;
+    check(best.total > small.total && best.total > side.total && best.total > blur.total, "best face scores highest");
+    check(best.size == 1 && std::fabs(small.size - 40.f / 112) < 1e-5, "size score");
+
+    // 4. 窗口：5帧内只保留最好的一帧
+    BestFaceWindow window(5, 0.95f);
+    const float qualities[5] = {0.4f, 0.7f, 0.5f, 0.6f, 0.3f};
+    int saved = 0, saved_frame = -1;
+    for (int f = 0; f < 5; f++)
+    {
+        check(!window.ready(1), "window not ready before 5 frames");
+        if (window.offer(1, qualities[f]))
+        {
+            window.crop(1).assign(4, (uint8_t)f);
+            saved++;
+            saved_frame = f;
+        }
+    }
+    check(window.ready(1) && saved == 2 && saved_frame == 1 && window.crop(1)[0] == 1, "window keeps the best frame");
+    check(window.best(1) == 0.7f, "best quality");
+    window.finish(1);
+    check(window.size() == 0 && !window.ready(1), "finish closes the window");
+
+    // 质量足够好时立即识别；窗口为1时每次都立即识别
+    window.offer(2, 0.97f);
+    check(window.ready(2), "good enough ends the window early");
+    BestFaceWindow immediate(1);
+    immediate.offer(3, 0.1f);
+    check(immediate.ready(3), "window of 1 is always ready");
+
+    // 轨迹消失后窗口被清理
+    window.offer(4, 0.2f);
+    FaceTracker tracker;
+    std::vector<FaceTrack> tracks = tracker.update({make_face(0, 0, 50, 0.9f)});
+    tracks[0].id = 4;
+    window.retain(tracks);
+    check(window.size() == 1 && !window.ready(4), "retain drops windows of lost tracks");
+
+    // 5. 耗时：每个需要识别的人脸每帧算一次
+    const int loops = 100000;
+    float acc = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++)
+        acc += FaceQuality::score(make_face(50, 100, 150, 0.95f), FaceQuality::sharpness(luma.data(), kWidth, kHeight, kWidth, {50, 100, 150, 150})).total;
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / loops;
+    cout << "quality score: " << us << " us/face (" << acc / loops << ")" << endl;
+
+    cout << (g_ret ? "test_face_quality failed" : "test_face_quality passed") << endl;
+    return g_ret;
+}
@@ -0,0 +1,201 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "frame_source.h"
+#include "latency_policy.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+static const int kWidth = 320;
+static const int kHeight = 240;
+
+typedef struct RunStats
+{
+    int processed;              // 处理的帧数
+    uint64_t dropped;           // 策略丢弃的帧数
+    double mean_age_ms;         // 处理完成时帧龄的平均值
+    double max_age_ms;          // 帧龄最大值
+    std::vector<unsigned long> ids; // 处理的帧号
+    double elapsed_ms;          // 总耗时
+} RunStats;
+
+// 模拟摄像头（camera_fps，缓存3帧）+ 每帧耗时work_ms的推理，按策略处理frames帧
+static RunStats run(LatencyPolicy policy, float camera_fps, int work_ms, int frames)
+{
+    SyntheticFrameSource camera(kWidth, kHeight, FRAME_NV12, 0, camera_fps, 3);
+    std::vector<uint8_t> isp(camera.frame_size());
+    RunStats stats = {0, 0, 0, 0, {}, 0};
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++)
+    {
+        FrameInfo info;
+        if (!policy.next(camera, isp.data(), info))
+            break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(work_ms));
+        double age = (FrameSource::now_us() - info.timestamp_us) / 1000.0;
+        stats.mean_age_ms += age;
+        stats.max_age_ms = std::max(stats.max_age_ms, age);
+        stats.ids.push_back(info.frame_id);
+        stats.processed++;
+    }
+    stats.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.mean_age_ms /= std::max(stats.processed, 1);
+    stats.dropped = policy.dropped();
+    return stats;
+}
+
+// 模拟vicap驱动的dump/release：grab从摄像头dump一帧，持有的帧需release归还，归还前驱动不会复用这块buffer。
+// release_first为true时按原先VicapFrameSource的顺序先归还再dump，非阻塞dump失败时持有的帧已经丢了
+class DumpReleaseSource : public FrameSource
+{
+public:
+    DumpReleaseSource(float fps, bool release_first)
+        : FrameSource(kWidth, kHeight, FRAME_NV12), camera_(kWidth, kHeight, FRAME_NV12, 0, fps, 3), release_first_(release_first),
+          holding_(false), dumps_(0), releases_(0)
+    {
+    }
+
+    bool grab(FrameInfo &info, int timeout_ms) override
+    {
+        if (release_first_)
+            discard();
+        FrameInfo frame;
+        if (!camera_.grab(frame, timeout_ms))
+            return false;
+        dumps_++;
+        discard();
+        // camera_.grab成功后camera_持有的就是新帧，这里只记录归还
+        holding_ = true;
+        info = frame;
+        return true;
+    }
+
+    bool retrieve(uint8_t *dst) override
+    {
+        if (!holding_)
+            return false;
+        holding_ = false;
+        releases_++;
+        return camera_.retrieve(dst);
+    }
+
+    void discard() override
+    {
+        if (!holding_)
+            return;
+        holding_ = false;
+        releases_++;
+    }
+
+    const char *name() const override
+    {
+        return "dump_release";
+    }
+
+    SyntheticFrameSource camera_;
+    bool release_first_;
+    bool holding_;
+    unsigned long dumps_;
+    unsigned long releases_;
+};
+
+// grab成功后再做一次非阻塞grab（失败），之前的帧仍可retrieve
+static bool failed_grab_keeps_frame(FrameSource &source)
+{
+    std::vector<uint8_t> frame(source.frame_size());
+    FrameInfo info, newer;
+    if (!source.grab(info, 1000))
+        return false;
+    while (source.grab(newer, 0))
+        info = newer;
+    return source.retrieve(frame.data());
+}
+
+static void print(const std::string &name, const RunStats &s)
+{
+    cout << name << ": processed " << s.processed << ", dropped " << s.dropped << ", age mean " << s.mean_age_ms
+         << " ms max " << s.max_age_ms << " ms, " << s.elapsed_ms << " ms" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    // 1. 解析
+    LatencyPolicy p;
+    check(p.mode() == LATENCY_NEWEST, "default newest");
+    check(LatencyPolicy::parse("all", p) && p.mode() == LATENCY_ALL, "parse all");
+    check(LatencyPolicy::parse("every:3", p) && p.mode() == LATENCY_EVERY_NTH && p.describe() == "every:3", "parse every");
+    check(LatencyPolicy::parse("fps:10", p) && p.mode() == LATENCY_TARGET_FPS, "parse fps");
+    check(!LatencyPolicy::parse("every:0", p) && !LatencyPolicy::parse("fps:-1", p) && !LatencyPolicy::parse("latest", p), "reject invalid");
+
+    // 2. 推理（12ms）慢于摄像头（200fps，5ms一帧）：all的帧龄涨到缓存深度，newest只丢旧帧
+    RunStats all = run(LatencyPolicy(LATENCY_ALL), 200.f, 12, 30);
+    RunStats newest = run(LatencyPolicy(LATENCY_NEWEST), 200.f, 12, 30);
+    print("all", all);
+    print("newest", newest);
+    check(all.dropped == 0, "all drops nothing itself");
+    check(newest.dropped > 0, "newest drops stale frames");
+    check(newest.mean_age_ms < all.mean_age_ms, "newest has lower latency");
+    // newest：帧龄最多为一个摄像头周期+推理耗时（再留出调度抖动）
+    check(newest.max_age_ms < 5 + 12 + 8, "newest latency bounded");
+
+    // 3. every:3在推理跟得上时处理第1、4、7...帧
+    RunStats every = run(LatencyPolicy(LATENCY_EVERY_NTH, 3), 200.f, 0, 10);
+    print("every:3", every);
+    bool stride = true;
+    for (size_t i = 1; i < every.ids.size(); i++)
+        stride = stride && every.ids[i] - every.ids[i - 1] == 3;
+    check(every.ids.size() == 10 && every.ids[0] == 1 && stride, "every third frame");
+    check(every.dropped == 18, "every:3 drop count");
+
+    // 4. fps:50，摄像头200fps、推理不耗时：处理间隔约20ms
+    RunStats fps = run(LatencyPolicy(LATENCY_TARGET_FPS, 1, 50.f), 200.f, 0, 20);
+    print("fps:50", fps);
+    double rate = (fps.processed - 1) * 1000.0 / fps.elapsed_ms;
+    cout << "fps:50 measured rate " << rate << endl;
+    check(rate > 40 && rate < 56, "target fps held");
+    check(fps.dropped >= 50, "target fps drops camera frames");
+
+    // 5. 不限速的数据源没有排队帧，newest不会丢帧
+    RunStats replay = run(LatencyPolicy(LATENCY_NEWEST), 0.f, 0, 50);
+    check(replay.processed == 50 && replay.dropped == 0 && replay.ids.back() == 50, "on-demand source not drained");
+
+    // 6. grab失败时保留持有的帧：newest最后一次非阻塞grab总是失败，此时不能丢掉已取到的最新帧
+    SyntheticFrameSource paced(kWidth, kHeight, FRAME_NV12, 0, 200.f, 3);
+    DumpReleaseSource vicap(200.f, false);
+    DumpReleaseSource release_first(200.f, true);
+    check(failed_grab_keeps_frame(paced), "synthetic keeps frame on failed grab");
+    check(failed_grab_keeps_frame(vicap), "dump/release keeps frame on failed grab");
+    check(!failed_grab_keeps_frame(release_first), "release before dump loses the frame");
+    std::vector<uint8_t> isp(vicap.frame_size());
+    LatencyPolicy newest_vicap(LATENCY_NEWEST), fps_vicap(LATENCY_TARGET_FPS, 1, 50.f), newest_broken(LATENCY_NEWEST);
+    int newest_ok = 0, fps_ok = 0;
+    for (int i = 0; i < 10; i++)
+    {
+        FrameInfo info;
+        std::this_thread::sleep_for(std::chrono::milliseconds(12));
+        newest_ok += newest_vicap.next(vicap, isp.data(), info);
+        fps_ok += fps_vicap.next(vicap, isp.data(), info);
+    }
+    cout << "dump/release: newest " << newest_ok << "/10, fps:50 " << fps_ok << "/10, dumps " << vicap.dumps_ << ", releases " << vicap.releases_ << endl;
+    check(newest_ok == 10 && fps_ok == 10, "policies process frames from a dump/release source");
+    check(vicap.dumps_ == vicap.releases_, "every dumped frame released");
+    FrameInfo info;
+    std::this_thread::sleep_for(std::chrono::milliseconds(12));
+    check(!newest_broken.next(release_first, isp.data(), info), "release before dump fails under newest");
+
+    cout << (g_ret ? "test_latency_policy failed" : "test_latency_policy passed") << endl;
+    return g_ret;
+}
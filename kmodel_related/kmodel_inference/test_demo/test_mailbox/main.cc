@@ -0,0 +1,69 @@
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include "latest_mailbox.hpp"
+#include "fps_counter.hpp"
+
+using std::cout;
+using std::endl;
+
+#define RUN_SECONDS (3)
+#define OSD_FPS (30)
+
+int main(int argc, char *argv[])
+{
+    // 用法：test_mailbox.elf [infer_ms]，模拟推理线程每帧耗时infer_ms，osd线程按30fps取最新结果
+    int infer_ms = argc > 1 ? atoi(argv[1]) : 10;
+    LatestMailbox<std::vector<int>> mailbox;
+    std::atomic<bool> stop(false);
+    std::atomic<int> published(0);
+
+    // 推理线程：每个结果的所有元素都等于帧号，读到不一致说明发生了撕裂
+    std::thread producer([&]()
+    {
+        FpsCounter fps("inference", 1);
+        for (int frame = 1; !stop; ++frame)
+        {
+            std::vector<int> &result = mailbox.write_slot();
+            result.assign(1000 + frame % 7, frame);
+            if (infer_ms > 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(infer_ms));
+            mailbox.publish();
+            published = frame;
+            fps.tick();
+        }
+    });
+
+    int drawn = 0, torn = 0, out_of_order = 0, last_frame = 0;
+    {
+        FpsCounter fps("osd", 1);
+        auto period = std::chrono::microseconds(1000000 / OSD_FPS);
+        auto next = std::chrono::steady_clock::now();
+        auto end = next + std::chrono::seconds(RUN_SECONDS);
+        while (std::chrono::steady_clock::now() < end)
+        {
+            if (mailbox.update())
+            {
+                std::vector<int> &result = mailbox.read_slot();
+                int frame = result.empty() ? 0 : result[0];
+                for (int v : result)
+                    torn += v != frame;
+                out_of_order += frame <= last_frame;
+                last_frame = frame;
+                ++drawn;
+                fps.tick();
+            }
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    }
+    stop = true;
+    producer.join();
+
+    cout << "published " << published << " results, osd drew " << drawn << endl;
+    cout << "torn results: " << torn << ", out of order: " << out_of_order << endl;
+    bool pass = torn == 0 && out_of_order == 0 && drawn > 0;
+    cout << (pass ? "Pass!" : "Fail!") << endl;
+    return pass ? 0 : -1;
+}
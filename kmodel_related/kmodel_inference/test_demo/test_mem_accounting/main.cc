@@ -0,0 +1,79 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <unistd.h>
+#include "mem_accounting.h"
+
+using std::cout;
+using std::endl;
+
+// 板上/proc/media-mem的格式，加载kmodel前
+static const char *kBefore =
+    "+---ZONE: PHYS(0x10000000, 0x1FFFFFFF), GFP=0, nBYTES=262144KB,    NAME=\"anonymous\"\n"
+    "   |-MMB: phys(0x10000000, 0x10000FFF), kvirt=0x0000000000000000, flags=0x00000000, length=4KB,    name=\"vb_pool\"\n"
+    "   |-MMB: phys(0x10001000, 0x10400FFF), kvirt=0x0000000000000000, flags=0x00000000, length=4096KB,    name=\"vo_osd\"\n"
+    "\n"
+    "---MMZ_USE_INFO:\n"
+    " total size=262144KB(256MB),used=4100KB(4MB + 4KB),remain=258044KB(251MB + 1020KB),zone_number=1,block_number=2\n";
+
+// 加载kmodel后：新增kmodel和输入tensor，释放了vb_pool
+static const char *kAfter =
+    "+---ZONE: PHYS(0x10000000, 0x1FFFFFFF), GFP=0, nBYTES=262144KB,    NAME=\"anonymous\"\n"
+    "   |-MMB: phys(0x10001000, 0x10400FFF), kvirt=0x0000000000000000, flags=0x00000000, length=4096KB,    name=\"vo_osd\"\n"
+    "   |-MMB: phys(0x10401000, 0x10600FFF), kvirt=0x0000000000000000, flags=0x00000000, length=2048KB,    name=\"nncase_kmodel\"\n"
+    "   |-MMB: phys(0x10601000, 0x1065CFFF), kvirt=0x0000000000000000, flags=0x00000000, length=368KB,    name=\"nncase_tensor\"\n"
+    "\n"
+    "---MMZ_USE_INFO:\n"
+    " total size=262144KB(256MB),used=6512KB(6MB + 368KB),remain=255632KB(249MB + 656KB),zone_number=1,block_number=3\n";
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    MemSnapshot before, after;
+    std::istringstream in_before(kBefore), in_after(kAfter);
+    check(MemAccounting::parse_media_mem(in_before, before), "parse before");
+    check(MemAccounting::parse_media_mem(in_after, after), "parse after");
+    check(before.mmbs.size() == 2 && after.mmbs.size() == 3, "mmb count");
+    check(before.mmz_total_bytes == 262144ull * 1024, "total size");
+    check(before.mmz_used_bytes == 4100ull * 1024, "used size");
+    check(after.mmbs[1].name == "nncase_kmodel" && after.mmbs[1].zone == "anonymous", "mmb name and zone");
+    check(after.mmbs[1].phys_start == 0x10401000 && after.mmbs[1].phys_end == 0x10600FFF, "mmb phys range");
+
+    before.rss_bytes = after.rss_bytes = 0;
+    MemDelta delta = MemAccounting::diff(before, after);
+    check(delta.mmz_bytes == (6512 - 4100) * 1024, "mmz delta");
+    check(delta.added.size() == 2 && delta.added[0].name == "nncase_kmodel", "added blocks");
+    check(delta.freed.size() == 1 && delta.freed[0].name == "vb_pool", "freed blocks");
+
+    // MemTracker：用K230_MEDIA_MEM_FILE指向fixture文件，模拟load_model前后
+    std::string fixture = std::string(argc > 1 ? argv[1] : ".") + "/test_media_mem.txt";
+    setenv("K230_MEDIA_MEM_FILE", fixture.c_str(), 1);
+    std::ofstream(fixture) << kBefore;
+    MemTracker tracker("test", true);
+    std::ofstream(fixture) << kAfter;
+    tracker.mark("load_model");
+    std::ofstream(fixture) << kBefore;
+    tracker.mark("release");
+    tracker.report();
+    check(tracker.peak_mmz_bytes() == (6512 - 4100) * 1024, "tracker peak");
+    check(tracker.steady_mmz_bytes() == 0, "tracker steady");
+    unlink(fixture.c_str());
+
+    MemTracker disabled("disabled", false);
+    disabled.mark("noop");
+    check(disabled.peak_mmz_bytes() == 0, "disabled tracker");
+
+    cout << (g_ret ? "test_mem_accounting failed" : "test_mem_accounting passed") << endl;
+    return g_ret;
+}
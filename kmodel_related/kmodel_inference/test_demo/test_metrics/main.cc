@@ -0,0 +1,125 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "metrics.h"
+#include "scoped_timing.hpp"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+static bool contains(const std::string &text, const std::string &line)
+{
+    return text.find(line + "\n") != std::string::npos;
+}
+
+// 像curl --unix-socket一样请求一次，返回应答
+static std::string scrape(const std::string &socket_path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path.c_str());
+    if (connect(fd, (sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        close(fd);
+        return "";
+    }
+    const char *req = "GET /metrics HTTP/1.0\r\n\r\n";
+    (void)!write(fd, req, strlen(req));
+    std::string resp;
+    char buf[4096];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0)
+        resp.append(buf, n);
+    close(fd);
+    return resp;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string dir = argc > 1 ? argv[1] : ".";
+    std::string file = dir + "/test_metrics.prom";
+    std::string socket_path = dir + "/test_metrics.sock";
+
+    Metrics &metrics = Metrics::instance();
+    Counter &frames = metrics.counter("k230_frames_total", "Frames captured from vicap");
+    Counter &drawn = metrics.counter("k230_results_total", "Inference results by pipeline point", "point=\"drawn\"");
+    Counter &published = metrics.counter("k230_results_total", "Inference results by pipeline point", "point=\"published\"");
+    Gauge &fps = metrics.gauge("k230_fps", "Frames per second of each thread", "thread=\"inference\"");
+    Histogram &h = metrics.histogram("test_latency_ms", "Test histogram", "", {1, 10});
+
+    check(&frames == &metrics.counter("k230_frames_total", "Frames captured from vicap"), "same counter returned twice");
+    frames.inc(3);
+    published.inc(2);
+    drawn.inc();
+    fps.set(29.5);
+    h.observe(0.5);
+    h.observe(5);
+    h.observe(50);
+
+    std::string text = metrics.render();
+    check(contains(text, "# TYPE k230_frames_total counter"), "counter type");
+    check(contains(text, "k230_frames_total 3"), "counter value");
+    check(contains(text, "k230_results_total{point=\"drawn\"} 1"), "labelled counter");
+    check(contains(text, "k230_results_total{point=\"published\"} 2"), "labelled counter");
+    check(text.find("# TYPE k230_results_total") == text.rfind("# TYPE k230_results_total"), "TYPE printed once per name");
+    check(contains(text, "k230_fps{thread=\"inference\"} 29.5"), "gauge value");
+    check(contains(text, "test_latency_ms_bucket{le=\"1\"} 1"), "bucket le=1");
+    check(contains(text, "test_latency_ms_bucket{le=\"10\"} 2"), "bucket le=10");
+    check(contains(text, "test_latency_ms_bucket{le=\"+Inf\"} 3"), "bucket +Inf");
+    check(contains(text, "test_latency_ms_sum 55.5"), "histogram sum");
+    check(contains(text, "test_latency_ms_count 3"), "histogram count");
+
+    // 开启导出后ScopedTiming的耗时计入k230_stage_duration_ms
+    metrics.start(file, socket_path, 50);
+    check(metrics.enabled(), "exporter started");
+    TimingLabel label("test stage");
+    for (int i = 0; i < 10; ++i)
+    {
+        ScopedTiming st(label, 0);
+    }
+    {
+        ScopedTiming st("test adhoc stage", 0);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    std::ifstream ifs(file);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    std::string file_text = ss.str();
+    check(contains(file_text, "k230_stage_duration_ms_count{stage=\"test stage\"} 10"), "stage histogram in file");
+    check(contains(file_text, "k230_stage_duration_ms_count{stage=\"test adhoc stage\"} 1"), "adhoc stage histogram in file");
+    check(access((file + ".tmp").c_str(), F_OK) != 0, "no temporary file left");
+
+    std::string resp = scrape(socket_path);
+    check(resp.compare(0, 15, "HTTP/1.0 200 OK") == 0, "socket http status");
+    check(resp.find("k230_frames_total 3\n") != std::string::npos, "socket body");
+
+    metrics.stop();
+    check(access(socket_path.c_str(), F_OK) != 0, "socket removed after stop");
+    {
+        ScopedTiming st(label, 0); // 停止后不再上报
+    }
+    check(contains(metrics.render(), "k230_stage_duration_ms_count{stage=\"test stage\"} 10"), "no observation after stop");
+    unlink(file.c_str());
+
+    cout << (g_ret ? "test_metrics failed" : "test_metrics passed") << endl;
+    return g_ret;
+}
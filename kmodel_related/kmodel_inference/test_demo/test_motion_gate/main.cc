@@ -0,0 +1,134 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "motion_gate.h"
+#include "face_tracker.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+static const int kWidth = 1280;
+static const int kHeight = 720;
+
+// 亮度平面：固定纹理背景+sensor噪声，可选一个移动的方块（人走过）
+static void render_luma(std::vector<uint8_t> &y, std::mt19937 &rng, int square_x)
+{
+    std::uniform_int_distribution<int> noise(-4, 4);
+    for (int r = 0; r < kHeight; r++)
+    {
+        for (int c = 0; c < kWidth; c++)
+        {
+            int v = 60 + ((r / 40 + c / 40) % 2) * 80 + noise(rng);
+            if (square_x >= 0 && c >= square_x && c < square_x + 200 && r >= 200 && r < 500)
+                v = 230;
+            y[(size_t)r * kWidth + c] = (uint8_t)std::max(0, std::min(255, v));
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::mt19937 rng(42);
+    std::vector<uint8_t> y((size_t)kWidth * kHeight);
+
+    // 1. 静止场景：只有第一帧和每max_skip帧强制检测一次
+    MotionGate gate(0.01f, 15);
+    int inferred = 0;
+    for (int f = 0; f < 60; f++)
+    {
+        render_luma(y, rng, -1);
+        inferred += gate.update_luma(y.data(), kWidth, kHeight, kWidth);
+    }
+    cout << "static scene: " << inferred << "/60 frames inferred, last change " << gate.change() << endl;
+    check(inferred == 4, "static scene skips until max_skip");
+    check(gate.change() < 0.01f, "noise below threshold");
+
+    // 2. 有人移动：每帧都检测
+    inferred = 0;
+    for (int f = 0; f < 30; f++)
+    {
+        render_luma(y, rng, 100 + f * 30);
+        inferred += gate.update_luma(y.data(), kWidth, kHeight, kWidth);
+    }
+    cout << "moving square: " << inferred << "/30 frames inferred" << endl;
+    check(inferred == 30, "motion triggers inference");
+
+    // 3. 人停下来之后又回到跳帧
+    render_luma(y, rng, 1000);
+    gate.update_luma(y.data(), kWidth, kHeight, kWidth);
+    render_luma(y, rng, 1000);
+    check(!gate.update_luma(y.data(), kWidth, kHeight, kWidth), "skips once the scene settles");
+    gate.force();
+    check(gate.update_luma(y.data(), kWidth, kHeight, kWidth), "force");
+
+    // 4. 缓慢移动：与上次检测的帧比较，累积的位移最终触发检测
+    MotionGate slow(0.01f, 1000);
+    render_luma(y, rng, 300);
+    slow.update_luma(y.data(), kWidth, kHeight, kWidth);
+    int first_trigger = -1;
+    for (int f = 1; f <= 40 && first_trigger < 0; f++)
+    {
+        render_luma(y, rng, 300 + f * 2);
+        if (slow.update_luma(y.data(), kWidth, kHeight, kWidth))
+            first_trigger = f;
+    }
+    cout << "slow motion (2 px/frame) triggered at frame " << first_trigger << endl;
+    check(first_trigger > 0, "slow motion accumulates");
+
+    // 5. 阈值<=0：不跳帧
+    MotionGate disabled(0.f);
+    for (int f = 0; f < 5; f++)
+        disabled.update_luma(y.data(), kWidth, kHeight, kWidth);
+    check(disabled.inferred() == 5 && disabled.skipped() == 0, "disabled gate");
+
+    // 6. rgb planar：三个通道相同时与亮度平面一致
+    std::vector<uint8_t> chw((size_t)kWidth * kHeight * 3);
+    for (int c = 0; c < 3; c++)
+        memcpy(chw.data() + c * y.size(), y.data(), y.size());
+    MotionGate rgb(0.01f, 15);
+    rgb.update_rgb_planar(chw.data(), kWidth, kHeight);
+    check(!rgb.update_rgb_planar(chw.data(), kWidth, kHeight) && rgb.change() == 0, "rgb planar static");
+    render_luma(y, rng, 100);
+    for (int c = 0; c < 3; c++)
+        memcpy(chw.data() + c * y.size(), y.data(), y.size());
+    check(rgb.update_rgb_planar(chw.data(), kWidth, kHeight), "rgb planar motion");
+
+    // 7. 跳帧时跟踪器只做预测，轨迹保持可见，五官点随框平移
+    FaceTracker tracker;
+    FaceDetectionInfo det = {{100, 100, 80, 100}, {{120, 140, 160, 140, 140, 160, 125, 180, 155, 180}}, 0.9f};
+    tracker.update({det});
+    for (int f = 0; f < 20; f++)
+        tracker.predict();
+    check(tracker.tracks().size() == 1 && tracker.tracks()[0].time_since_update == 0, "predict keeps tracks visible");
+    const FaceTrack &track = tracker.tracks()[0];
+    check(std::abs(track.det.sparse_kps.points[0] - track.det.bbox.x - 20) < 1e-3, "landmarks follow prediction");
+
+    // 8. 耗时：与检测kmodel相比可忽略
+    const int loops = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++)
+        gate.update_luma(y.data(), kWidth, kHeight, kWidth);
+    double luma_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / loops;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++)
+        rgb.update_rgb_planar(chw.data(), kWidth, kHeight);
+    double rgb_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / loops;
+    cout << "update " << kWidth << "x" << kHeight << ": luma " << luma_us << " us, rgb planar " << rgb_us << " us" << endl;
+
+    cout << (g_ret ? "test_motion_gate failed" : "test_motion_gate passed") << endl;
+    return g_ret;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <cstring>
+#include <opencv2/imgproc.hpp>
+#include "osd_compositor.h"
+#include "scoped_timing.hpp"
+
+using std::cout;
+using std::endl;
+
+#define OSD_WIDTH (1920)
+#define OSD_HEIGHT (1080)
+#define OSD_BUFFER_NUM (2)
+#define FRAME_NUM (100)
+
+// 模拟第frame帧第i个人脸的位置：框在画面中缓慢移动
+static cv::Rect face_rect(int frame, int i)
+{
+    int x = 100 + i * 300 + (frame * 7) % 200;
+    int y = 200 + (i % 2) * 300 + (frame * 3) % 150;
+    return cv::Rect(x, y, 220, 260);
+}
+
+// 和FaceDetection::draw_result(osd)相同的绘制内容
+static void draw_faces(OsdCompositor &osd, int frame, int face_num)
+{
+    for (int i = 0; i < face_num; ++i)
+    {
+        cv::Rect r = face_rect(frame, i);
+        for (int k = 0; k < 5; ++k)
+            osd.circle(cv::Point(r.x + 40 + k * 30, r.y + 100 + (k % 2) * 40), 4, cv::Scalar(0, 255, 255, 255), 8);
+        osd.rectangle(r, cv::Scalar(255, 255, 255, 255), 6);
+        osd.put_text("0.98", {r.x, r.y}, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(255, 0, 255, 255), 1);
+    }
+}
+
+// 原来的做法：每帧新建清零的osd_frame，画完后整帧拷贝到osd buffer
+static void draw_faces_full(cv::Mat &osd_frame, int frame, int face_num)
+{
+    for (int i = 0; i < face_num; ++i)
+    {
+        cv::Rect r = face_rect(frame, i);
+        for (int k = 0; k < 5; ++k)
+            cv::circle(osd_frame, cv::Point(r.x + 40 + k * 30, r.y + 100 + (k % 2) * 40), 4, cv::Scalar(0, 255, 255, 255), 8);
+        cv::rectangle(osd_frame, r, cv::Scalar(255, 255, 255, 255), 6, cv::LINE_8, 0);
+        cv::putText(osd_frame, "0.98", {r.x, r.y}, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(255, 0, 255, 255), 1, cv::LINE_8, false);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // 用法：test_osd.elf [face_num]
+    int face_num = argc > 1 ? atoi(argv[1]) : 5;
+    size_t frame_bytes = (size_t)OSD_WIDTH * OSD_HEIGHT * 4;
+    std::vector<std::vector<uint8_t>> buffers(OSD_BUFFER_NUM, std::vector<uint8_t>(frame_bytes, 0xff));
+    std::vector<void *> buffer_ptrs;
+    for (auto &b : buffers)
+        buffer_ptrs.push_back(b.data());
+
+    /**********************原方案：整帧清零 + 绘制 + 整帧拷贝*************************/
+    {
+        ScopedTiming st("full clear + draw + memcpy x100", 1);
+        for (int f = 0; f < FRAME_NUM; ++f)
+        {
+            cv::Mat osd_frame(OSD_HEIGHT, OSD_WIDTH, CV_8UC4, cv::Scalar(0, 0, 0, 0));
+            draw_faces_full(osd_frame, f, face_num);
+            memcpy(buffers[0].data(), osd_frame.data, frame_bytes);
+        }
+    }
+    cout << "full frame bytes touched per frame: " << frame_bytes * 3 << " (clear + draw buffer + memcpy dst)" << endl;
+
+    /**********************OsdCompositor：只清除和重画变化区域*************************/
+    OsdCompositor osd(OSD_WIDTH, OSD_HEIGHT, buffer_ptrs);
+    size_t bytes_touched = 0;
+    int last_index = 0;
+    {
+        ScopedTiming st("OsdCompositor dirty rect x100", 1);
+        for (int f = 0; f < FRAME_NUM; ++f)
+        {
+            osd.begin_frame();
+            draw_faces(osd, f, face_num);
+            last_index = osd.end_frame();
+            // 前OSD_BUFFER_NUM帧是首次使用buffer的整帧清零，不计入
+            if (f >= OSD_BUFFER_NUM)
+                bytes_touched += osd.bytes_touched();
+        }
+    }
+    cout << "OsdCompositor bytes touched per frame: " << bytes_touched / (FRAME_NUM - OSD_BUFFER_NUM) << endl;
+
+    // 校验：经过多帧局部清除后，最后一帧的buffer应与在全新buffer上重画的结果完全一致
+    std::vector<uint8_t> ref(frame_bytes);
+    OsdCompositor ref_osd(OSD_WIDTH, OSD_HEIGHT, {ref.data()});
+    ref_osd.begin_frame();
+    draw_faces(ref_osd, FRAME_NUM - 1, face_num);
+    ref_osd.end_frame();
+    bool same = memcmp(ref.data(), buffers[last_index].data(), frame_bytes) == 0;
+    cout << "compare with full redraw: " << (same ? "Pass!" : "Fail!") << endl;
+    return same ? 0 : -1;
+}
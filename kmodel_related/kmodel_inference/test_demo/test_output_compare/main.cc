@@ -0,0 +1,108 @@
+#include <iostream>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "output_compare.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+static bool near(double a, double b, double eps = 1e-6)
+{
+    return std::fabs(a - b) < eps;
+}
+
+int main(int argc, char *argv[])
+{
+    // float32：完全一致
+    std::vector<float> f0 = {1, 2, 3, 4};
+    CompareResult r = OutputCompare::compare(f0.data(), f0.data(), f0.size() * sizeof(float), DT_FLOAT32);
+    check(r.count == 4 && r.bit_exact && near(r.cosine, 1) && r.max_abs == 0 && r.rmse == 0, "float32 identical");
+    check(r.topk_agreement < 0, "topk not computed by default");
+
+    // float32：一个元素偏差0.5
+    std::vector<float> f1 = {1, 2, 3.5f, 4};
+    r = OutputCompare::compare(f1.data(), f0.data(), f0.size() * sizeof(float), DT_FLOAT32);
+    check(!r.bit_exact && near(r.max_abs, 0.5) && near(r.rmse, 0.25), "float32 max_abs/rmse");
+
+    // uint8：按float解释会得到无意义的值，按uint8解码后200与201只差1
+    std::vector<uint8_t> u0 = {0, 100, 200, 255}, u1 = {0, 100, 201, 255};
+    r = OutputCompare::compare(u1.data(), u0.data(), u0.size(), DT_UINT8);
+    check(r.count == 4 && near(r.max_abs, 1) && r.cosine > 0.9999, "uint8 decode");
+
+    // int8：负数
+    std::vector<int8_t> i0 = {-128, -1, 1, 127};
+    r = OutputCompare::compare(i0.data(), i0.data(), i0.size(), DT_INT8);
+    check(near(r.cosine, 1), "int8 identical");
+    std::vector<int8_t> i1 = {127, 1, -1, -128};
+    r = OutputCompare::compare(i1.data(), i0.data(), i0.size(), DT_INT8);
+    check(near(r.cosine, -1, 1e-2) && near(r.max_abs, 255), "int8 negative");
+
+    // float16：0x3c00=1.0，0x4000=2.0，0xc200=-3.0，0x0001为最小的非规格化数
+    std::vector<uint16_t> h0 = {0x3c00, 0x4000, 0xc200, 0x0001};
+    std::vector<float> h0f = {1.0f, 2.0f, -3.0f, 0};
+    r = OutputCompare::compare(h0.data(), h0.data(), h0.size() * 2, DT_FLOAT16);
+    check(r.count == 4 && near(r.cosine, 1), "float16 identical");
+    std::vector<uint16_t> h1 = {0x3c00, 0x4000, 0xc200, 0x0000};
+    r = OutputCompare::compare(h1.data(), h0.data(), h0.size() * 2, DT_FLOAT16);
+    check(near(r.max_abs, std::ldexp(1.0, -24), 1e-12), "float16 subnormal");
+    std::vector<uint16_t> h2 = {0x3c00, 0x4000, 0x4200, 0x0000};
+    r = OutputCompare::compare(h2.data(), h0.data(), h0.size() * 2, DT_FLOAT16);
+    check(near(r.max_abs, 6), "float16 sign");
+
+    // bfloat16：0x3f80=1.0，0x4040=3.0
+    std::vector<uint16_t> b0 = {0x3f80, 0x4040}, b1 = {0x3f80, 0x3f80};
+    r = OutputCompare::compare(b1.data(), b0.data(), b0.size() * 2, DT_BFLOAT16);
+    check(near(r.max_abs, 2), "bfloat16 decode");
+
+    // 全0与全0余弦为1，全0与非0为0
+    std::vector<float> z = {0, 0, 0, 0};
+    check(near(OutputCompare::compare(z.data(), z.data(), 16, DT_FLOAT32).cosine, 1), "zero vs zero");
+    check(near(OutputCompare::compare(z.data(), f0.data(), 16, DT_FLOAT32).cosine, 0), "zero vs nonzero");
+
+    // top-k一致率：期望top2为{3, 2}，实际top2为{3, 0}
+    std::vector<float> s0 = {0.1f, 0.2f, 0.3f, 0.9f}, s1 = {0.5f, 0.2f, 0.3f, 0.9f};
+    r = OutputCompare::compare(s1.data(), s0.data(), 16, DT_FLOAT32, 2);
+    check(near(r.topk_agreement, 0.5), "top2 agreement");
+    r = OutputCompare::compare(s1.data(), s0.data(), 16, DT_FLOAT32, 1);
+    check(near(r.topk_agreement, 1), "top1 agreement");
+    r = OutputCompare::compare(s1.data(), s0.data(), 16, DT_FLOAT32, 10);
+    check(near(r.topk_agreement, 1), "topk larger than count");
+
+    // 阈值检查
+    CompareThreshold threshold;
+    std::string reason;
+    r = OutputCompare::compare(f1.data(), f0.data(), 16, DT_FLOAT32, 1);
+    check(OutputCompare::check(r, threshold, reason) && reason.empty(), "no threshold passes");
+    threshold.cosine_min = 0.99;
+    threshold.max_abs_max = 0.6;
+    threshold.topk = 1;
+    threshold.topk_min = 1;
+    check(OutputCompare::check(r, threshold, reason), "thresholds pass");
+    threshold.max_abs_max = 0.1;
+    threshold.rmse_max = 0.1;
+    check(!OutputCompare::check(r, threshold, reason) && reason.find("max_abs") != std::string::npos && reason.find("rmse") != std::string::npos,
+          "thresholds fail with reason");
+    cout << "reason: " << reason << endl;
+
+    // 数据类型名称与nncase一致
+    TensorDType dtype;
+    check(OutputCompare::parse_dtype("float16", dtype) && dtype == DT_FLOAT16, "parse float16");
+    check(!OutputCompare::parse_dtype("float8", dtype), "parse unknown");
+    check(std::string(OutputCompare::dtype_name(DT_UINT8)) == "uint8" && OutputCompare::dtype_size(DT_INT64) == 8, "dtype name/size");
+
+    cout << (g_ret ? "test_output_compare failed" : "test_output_compare passed") << endl;
+    return g_ret;
+}
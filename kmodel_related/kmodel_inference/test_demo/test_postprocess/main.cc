@@ -0,0 +1,406 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "binary_io.h"
+#include "fast_exp.hpp"
+#include "retinaface_decoder.h"
+
+using std::cout;
+using std::endl;
+
+// anchor表：原先的解码查这两张表，这里作为参考
+extern float kAnchors320[4200][4];
+extern float kAnchors640[16800][4];
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+#define OBJ_THRESH (0.6f)
+#define NMS_THRESH (0.2f)
+#define LOOP_NUM (200)
+
+// 模型的三个输出
+struct HeadOutputs
+{
+    std::vector<float> loc;
+    std::vector<float> conf;
+    std::vector<float> landms;
+};
+
+static float box_iou(const Bbox &a, const Bbox &b)
+{
+    float w = std::min(a.x + a.w, b.x + b.w) - std::max(a.x, b.x);
+    float h = std::min(a.y + a.h, b.y + b.h) - std::max(a.y, b.y);
+    if (w < 0 || h < 0)
+        return 0;
+    float i = w * h;
+    return i / (a.w * a.h + b.w * b.h - i);
+}
+
+/********************原先的解码：过滤、排序，nms中每个候选框反复查表、用double字面量解码***********************/
+struct LegacyRoi
+{
+    int ori_roi_index;
+    int before_sort_conf_index;
+    float confidence;
+};
+
+static Bbox legacy_decode_box(float (*anchors)[4], const std::vector<std::array<float, LOC_SIZE>> &boxes, const LegacyRoi &roi)
+{
+    float cx = boxes[roi.before_sort_conf_index][0];
+    float cy = boxes[roi.before_sort_conf_index][1];
+    float w = boxes[roi.before_sort_conf_index][2];
+    float h = boxes[roi.before_sort_conf_index][3];
+    int a = roi.ori_roi_index;
+    cx = anchors[a][0] + cx * 0.1 * anchors[a][2];
+    cy = anchors[a][1] + cy * 0.1 * anchors[a][3];
+    w = anchors[a][2] * std::exp(w * 0.2);
+    h = anchors[a][3] * std::exp(h * 0.2);
+    return {cx - w / 2, cy - h / 2, w, h};
+}
+
+static void legacy_post_process(float (*anchors)[4], int objs_num, const HeadOutputs &out, std::vector<FaceDetectionInfo> &results)
+{
+    std::vector<LegacyRoi> confs;
+    for (int i = 0; i < objs_num; i++)
+    {
+        float score = out.conf[i * CONF_SIZE + 1];
+        if (score > OBJ_THRESH)
+            confs.push_back({i, (int)confs.size(), score});
+    }
+    std::vector<std::array<float, LOC_SIZE>> boxes(confs.size());
+    std::vector<std::array<float, LAND_SIZE>> landmarks(confs.size());
+    for (size_t c = 0; c < confs.size(); c++)
+    {
+        for (int i = 0; i < LOC_SIZE; i++)
+            boxes[c][i] = out.loc[confs[c].ori_roi_index * LOC_SIZE + i];
+        for (int i = 0; i < LAND_SIZE; i++)
+            landmarks[c][i] = out.landms[confs[c].ori_roi_index * LAND_SIZE + i];
+    }
+    std::stable_sort(confs.begin(), confs.end(), [](const LegacyRoi &a, const LegacyRoi &b) { return a.confidence > b.confidence; });
+
+    for (size_t c = 0; c < confs.size(); c++)
+    {
+        if (confs[c].confidence < 0)
+            continue;
+        FaceDetectionInfo obj;
+        obj.bbox = legacy_decode_box(anchors, boxes, confs[c]);
+        int a = confs[c].ori_roi_index;
+        for (int ll = 0; ll < 5; ll++)
+        {
+            obj.sparse_kps.points[2 * ll] = anchors[a][0] + landmarks[confs[c].before_sort_conf_index][2 * ll] * 0.1 * anchors[a][2];
+            obj.sparse_kps.points[2 * ll + 1] = anchors[a][1] + landmarks[confs[c].before_sort_conf_index][2 * ll + 1] * 0.1 * anchors[a][3];
+        }
+        obj.score = confs[c].confidence;
+        results.push_back(obj);
+        for (size_t j = c + 1; j < confs.size(); j++)
+        {
+            if (confs[j].confidence < 0)
+                continue;
+            if (box_iou(obj.bbox, legacy_decode_box(anchors, boxes, confs[j])) >= NMS_THRESH)
+                confs[j].confidence = -1;
+        }
+    }
+}
+
+/********************现在的解码：一次遍历解码候选框，排序后nms不再解码***********************/
+static void post_process(RetinaFaceDecoder &decoder, const HeadOutputs &out, std::vector<FaceDetectionInfo> &candidates, std::vector<FaceDetectionInfo> &results)
+{
+    candidates.clear();
+    decoder.decode(out.loc.data(), out.conf.data(), out.landms.data(), OBJ_THRESH, candidates);
+    std::stable_sort(candidates.begin(), candidates.end(), [](const FaceDetectionInfo &a, const FaceDetectionInfo &b) { return a.score > b.score; });
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        if (candidates[i].score < 0)
+            continue;
+        results.push_back(candidates[i]);
+        for (size_t j = i + 1; j < candidates.size(); j++)
+        {
+            if (candidates[j].score >= 0 && box_iou(candidates[i].bbox, candidates[j].bbox) >= NMS_THRESH)
+                candidates[j].score = -1;
+        }
+    }
+}
+
+// 两组结果的最大坐标差，个数或得分不同时返回无穷大
+static float max_diff(const std::vector<FaceDetectionInfo> &a, const std::vector<FaceDetectionInfo> &b)
+{
+    if (a.size() != b.size())
+        return INFINITY;
+    float diff = 0;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (a[i].score != b[i].score)
+            return INFINITY;
+        diff = std::max(diff, std::fabs(a[i].bbox.x - b[i].bbox.x));
+        diff = std::max(diff, std::fabs(a[i].bbox.y - b[i].bbox.y));
+        diff = std::max(diff, std::fabs(a[i].bbox.w - b[i].bbox.w));
+        diff = std::max(diff, std::fabs(a[i].bbox.h - b[i].bbox.h));
+        for (int k = 0; k < LAND_SIZE; k++)
+            diff = std::max(diff, std::fabs(a[i].sparse_kps.points[k] - b[i].sparse_kps.points[k]));
+    }
+    return diff;
+}
+
+// 两组结果的最大坐标差和得分差，个数不同时返回无穷大（logit模式、fast_exp的得分与概率模式只差舍入误差）
+static float max_diff_scored(const std::vector<FaceDetectionInfo> &a, const std::vector<FaceDetectionInfo> &b)
+{
+    if (a.size() != b.size())
+        return INFINITY;
+    float diff = 0;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        diff = std::max(diff, std::fabs(a[i].score - b[i].score));
+        diff = std::max(diff, std::fabs(a[i].bbox.x - b[i].bbox.x));
+        diff = std::max(diff, std::fabs(a[i].bbox.y - b[i].bbox.y));
+        diff = std::max(diff, std::fabs(a[i].bbox.w - b[i].bbox.w));
+        diff = std::max(diff, std::fabs(a[i].bbox.h - b[i].bbox.h));
+        for (int k = 0; k < LAND_SIZE; k++)
+            diff = std::max(diff, std::fabs(a[i].sparse_kps.points[k] - b[i].sparse_kps.points[k]));
+    }
+    return diff;
+}
+
+// 随机输出：大部分anchor为背景，另有若干人脸，每个人脸附近的一簇anchor置信度高
+static HeadOutputs random_outputs(int objs_num, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> offset(0.f, 1.f);
+    std::uniform_real_distribution<float> background(0.f, 0.3f);
+    std::uniform_real_distribution<float> face(0.6f, 1.f);
+    HeadOutputs out;
+    out.loc.resize(objs_num * LOC_SIZE);
+    out.conf.resize(objs_num * CONF_SIZE);
+    out.landms.resize(objs_num * LAND_SIZE);
+    for (auto &v : out.loc)
+        v = offset(rng);
+    for (auto &v : out.landms)
+        v = offset(rng);
+    for (int i = 0; i < objs_num; i++)
+        out.conf[i * CONF_SIZE + 1] = background(rng);
+    for (int f = 0; f < 8; f++)
+    {
+        int center = rng() % (objs_num - 16);
+        for (int i = center; i < center + 16; i++)
+            out.conf[i * CONF_SIZE + 1] = face(rng);
+    }
+    for (int i = 0; i < objs_num; i++)
+        out.conf[i * CONF_SIZE] = 1.f - out.conf[i * CONF_SIZE + 1];
+    return out;
+}
+
+template <typename F>
+static double time_us(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LOOP_NUM; i++)
+        f();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / LOOP_NUM;
+}
+
+// 对同一组输出比较并计时：原先的解码、通用解码器、编译期特化的解码器
+static void compare(const std::string &name, float (*anchors)[4], RetinaFaceDecoder &generic, RetinaFaceDecoder &fixed, const HeadOutputs &out)
+{
+    int objs_num = fixed.anchors_num();
+    std::vector<FaceDetectionInfo> candidates, legacy, generic_results, fixed_results;
+    legacy_post_process(anchors, objs_num, out, legacy);
+    post_process(generic, out, candidates, generic_results);
+    post_process(fixed, out, candidates, fixed_results);
+    float generic_diff = max_diff(legacy, generic_results);
+    float fixed_diff = max_diff(legacy, fixed_results);
+    cout << name << ": " << legacy.size() << " faces, max diff generic " << generic_diff << ", fixed " << fixed_diff << endl;
+    check(!legacy.empty(), name + " has faces");
+    check(generic_diff < 1e-5f, name + " generic matches legacy");
+    check(fixed_diff < 1e-5f, name + " fixed matches legacy");
+    check(max_diff(generic_results, fixed_results) < 1e-6f, name + " fixed matches generic");
+
+    double legacy_us = time_us([&]() { std::vector<FaceDetectionInfo> r; legacy_post_process(anchors, objs_num, out, r); });
+    double generic_us = time_us([&]() { std::vector<FaceDetectionInfo> r; post_process(generic, out, candidates, r); });
+    double fixed_us = time_us([&]() { std::vector<FaceDetectionInfo> r; post_process(fixed, out, candidates, r); });
+    cout << name << " post_process: legacy " << legacy_us << " us, generic " << generic_us << " us, fixed " << fixed_us << " us ("
+         << legacy_us / fixed_us << "x)" << endl;
+}
+
+// 把概率输出换成去掉softmax的模型的输出：softmax时为两个通道的logit（ln p），sigmoid时为人脸通道的logit
+static HeadOutputs to_logits(const HeadOutputs &out, ScoreMode score_mode)
+{
+    HeadOutputs logits = out;
+    for (size_t i = 0; i < out.conf.size(); i += CONF_SIZE)
+    {
+        float p0 = std::min(std::max(out.conf[i], 1e-7f), 1.f - 1e-7f);
+        float p1 = std::min(std::max(out.conf[i + 1], 1e-7f), 1.f - 1e-7f);
+        if (score_mode == SCORE_SOFTMAX_LOGITS)
+        {
+            logits.conf[i] = std::log(p0);
+            logits.conf[i + 1] = std::log(p1);
+        }
+        else
+        {
+            logits.conf[i] = 0;
+            logits.conf[i + 1] = std::log(p1 / (1.f - p1));
+        }
+    }
+    return logits;
+}
+
+// 逐anchor做softmax得到概率后再按概率解码，对比阈值在logit域比较
+static void softmax_every_anchor(RetinaFaceDecoder &decoder, const HeadOutputs &logits, std::vector<float> &probs, std::vector<FaceDetectionInfo> &candidates, std::vector<FaceDetectionInfo> &results)
+{
+    probs.resize(logits.conf.size());
+    for (size_t i = 0; i < logits.conf.size(); i += CONF_SIZE)
+    {
+        float m = std::max(logits.conf[i], logits.conf[i + 1]);
+        float e0 = std::exp(logits.conf[i] - m);
+        float e1 = std::exp(logits.conf[i + 1] - m);
+        probs[i] = e0 / (e0 + e1);
+        probs[i + 1] = e1 / (e0 + e1);
+    }
+    candidates.clear();
+    decoder.decode(logits.loc.data(), probs.data(), logits.landms.data(), OBJ_THRESH, candidates);
+    std::stable_sort(candidates.begin(), candidates.end(), [](const FaceDetectionInfo &a, const FaceDetectionInfo &b) { return a.score > b.score; });
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        if (candidates[i].score < 0)
+            continue;
+        results.push_back(candidates[i]);
+        for (size_t j = i + 1; j < candidates.size(); j++)
+        {
+            if (candidates[j].score >= 0 && box_iou(candidates[i].bbox, candidates[j].bbox) >= NMS_THRESH)
+                candidates[j].score = -1;
+        }
+    }
+}
+
+// logit模式、fast_exp与概率模式的结果一致，并比较耗时
+static void compare_score_modes(const std::string &name, int input_size, const HeadOutputs &out)
+{
+    std::unique_ptr<RetinaFaceDecoder> prob = RetinaFaceDecoder::create(input_size);
+    std::unique_ptr<RetinaFaceDecoder> prob_fast = RetinaFaceDecoder::create(input_size, SCORE_PROBABILITY, true);
+    std::unique_ptr<RetinaFaceDecoder> softmax = RetinaFaceDecoder::create(input_size, SCORE_SOFTMAX_LOGITS);
+    std::unique_ptr<RetinaFaceDecoder> softmax_fast = RetinaFaceDecoder::create(input_size, SCORE_SOFTMAX_LOGITS, true);
+    std::unique_ptr<RetinaFaceDecoder> sigmoid_fast = RetinaFaceDecoder::create(input_size, SCORE_SIGMOID_LOGIT, true);
+    HeadOutputs softmax_out = to_logits(out, SCORE_SOFTMAX_LOGITS);
+    HeadOutputs sigmoid_out = to_logits(out, SCORE_SIGMOID_LOGIT);
+
+    std::vector<float> probs;
+    std::vector<FaceDetectionInfo> candidates, ref, r_prob_fast, r_softmax, r_softmax_fast, r_sigmoid_fast, r_naive;
+    post_process(*prob, out, candidates, ref);
+    post_process(*prob_fast, out, candidates, r_prob_fast);
+    post_process(*softmax, softmax_out, candidates, r_softmax);
+    post_process(*softmax_fast, softmax_out, candidates, r_softmax_fast);
+    post_process(*sigmoid_fast, sigmoid_out, candidates, r_sigmoid_fast);
+    softmax_every_anchor(*prob, softmax_out, probs, candidates, r_naive);
+    cout << name << ": " << ref.size() << " faces, max diff prob+fast_exp " << max_diff_scored(ref, r_prob_fast) << ", softmax "
+         << max_diff_scored(ref, r_softmax) << ", softmax+fast_exp " << max_diff_scored(ref, r_softmax_fast) << ", sigmoid+fast_exp "
+         << max_diff_scored(ref, r_sigmoid_fast) << ", softmax every anchor " << max_diff_scored(ref, r_naive) << endl;
+    check(max_diff_scored(ref, r_prob_fast) < 1e-5f, name + " fast_exp matches std::exp");
+    check(max_diff_scored(ref, r_softmax) < 1e-5f, name + " softmax logits match probabilities");
+    check(max_diff_scored(ref, r_softmax_fast) < 1e-5f, name + " softmax logits with fast_exp match probabilities");
+    check(max_diff_scored(ref, r_sigmoid_fast) < 1e-5f, name + " sigmoid logit with fast_exp matches probabilities");
+    check(max_diff_scored(ref, r_naive) < 1e-5f, name + " softmax every anchor matches probabilities");
+
+    double prob_us = time_us([&]() { std::vector<FaceDetectionInfo> r; post_process(*prob, out, candidates, r); });
+    double prob_fast_us = time_us([&]() { std::vector<FaceDetectionInfo> r; post_process(*prob_fast, out, candidates, r); });
+    double naive_us = time_us([&]() { std::vector<FaceDetectionInfo> r; softmax_every_anchor(*prob, softmax_out, probs, candidates, r); });
+    double softmax_us = time_us([&]() { std::vector<FaceDetectionInfo> r; post_process(*softmax, softmax_out, candidates, r); });
+    double softmax_fast_us = time_us([&]() { std::vector<FaceDetectionInfo> r; post_process(*softmax_fast, softmax_out, candidates, r); });
+    cout << name << " post_process: prob " << prob_us << " us, prob+fast_exp " << prob_fast_us << " us; softmax every anchor " << naive_us
+         << " us, logit threshold " << softmax_us << " us, logit threshold+fast_exp " << softmax_fast_us << " us (" << naive_us / softmax_fast_us << "x)" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string dir = argc > 1 ? argv[1] : ".";
+
+    // 1. anchor：按规则生成的anchor与原先的表一致，其它输入边长走通用解码器
+    GenericRetinaFaceDecoder generic320(320), generic640(640);
+    FixedRetinaFaceDecoder<320> fixed320;
+    FixedRetinaFaceDecoder<640> fixed640;
+    check(fixed320.anchors_num() == 4200 && fixed640.anchors_num() == 16800, "fixed anchors num");
+    check(generic320.anchors_num() == 4200 && generic640.anchors_num() == 16800, "generic anchors num");
+    float anchor_diff = 0;
+    for (int i = 0; i < 4200; i++)
+        for (int k = 0; k < 4; k++)
+            anchor_diff = std::max(anchor_diff, std::fabs(generic320.anchors()[i][k] - kAnchors320[i][k]));
+    for (int i = 0; i < 16800; i++)
+        for (int k = 0; k < 4; k++)
+            anchor_diff = std::max(anchor_diff, std::fabs(generic640.anchors()[i][k] - kAnchors640[i][k]));
+    cout << "anchor max diff " << anchor_diff << endl;
+    check(anchor_diff < 1e-6f, "generated anchors match tables");
+    check(dynamic_cast<FixedRetinaFaceDecoder<640> *>(RetinaFaceDecoder::create(640).get()) != nullptr, "640 uses fixed decoder");
+    check(dynamic_cast<GenericRetinaFaceDecoder *>(RetinaFaceDecoder::create(320).get()) != nullptr, "320 uses generic decoder");
+    std::unique_ptr<RetinaFaceDecoder> other = RetinaFaceDecoder::create(480);
+    check(dynamic_cast<GenericRetinaFaceDecoder *>(other.get()) != nullptr && other->anchors_num() == 9450, "480 uses generic decoder");
+
+    // 2. simulator输出（face_detect_640.kmodel），与原先的解码结果一致并比较耗时
+    HeadOutputs simu;
+    if (BinaryIO::read_vector((dir + "/face_det_0_k230_simu.bin").c_str(), simu.loc) &&
+        BinaryIO::read_vector((dir + "/face_det_1_k230_simu.bin").c_str(), simu.conf) &&
+        BinaryIO::read_vector((dir + "/face_det_2_k230_simu.bin").c_str(), simu.landms))
+    {
+        check(simu.conf.size() == 16800 * CONF_SIZE && simu.loc.size() == 16800 * LOC_SIZE && simu.landms.size() == 16800 * LAND_SIZE, "simulator output size");
+        if (simu.conf.size() == 16800 * CONF_SIZE)
+            compare("simulator 640", kAnchors640, generic640, fixed640, simu);
+    }
+    else
+    {
+        cout << "face_det_*_k230_simu.bin not found in " << dir << ", skip simulator outputs" << endl;
+    }
+
+    // 3. 随机输出：320、640
+    compare("random 320", kAnchors320, generic320, fixed320, random_outputs(4200, 1));
+    compare("random 640", kAnchors640, generic640, fixed640, random_outputs(16800, 2));
+
+    // 4. fast_exp：[-87, 88]内的相对误差不超过FAST_EXP_MAX_REL_ERROR，比较数组计算的耗时
+    float exp_err = 0;
+    for (float x = -87.f; x <= 88.f; x += 1e-3f)
+    {
+        double ref = std::exp((double)x);
+        exp_err = std::max(exp_err, (float)(std::fabs(fast_exp(x) - ref) / ref));
+    }
+    cout << "fast_exp max relative error " << exp_err << endl;
+    check(exp_err < FAST_EXP_MAX_REL_ERROR, "fast_exp error bound");
+    check(fast_exp(-1000.f) > 0 && std::isfinite(fast_exp(1000.f)), "fast_exp clamps out of range inputs");
+    std::vector<float> exp_in(4096), exp_out(4096);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> exp_arg(-10.f, 10.f);
+    for (auto &v : exp_in)
+        v = exp_arg(rng);
+    double std_exp_us = time_us([&]() {
+        for (size_t i = 0; i < exp_in.size(); i++)
+            exp_out[i] = std::exp(exp_in[i]);
+    });
+    double fast_exp_us = time_us([&]() { fast_exp(exp_in.data(), exp_out.data(), (int)exp_in.size()); });
+    cout << "exp of " << exp_in.size() << " floats: std::exp " << std_exp_us << " us, fast_exp " << fast_exp_us << " us ("
+         << std_exp_us / fast_exp_us << "x)" << endl;
+
+    // 5. 置信度为logit：阈值换算到logit域，只有保留的anchor换算成概率，结果与概率模式一致
+    check(RetinaFaceDecoder::score_threshold(SCORE_PROBABILITY, 0.6f) == 0.6f, "probability threshold unchanged");
+    check(std::fabs(RetinaFaceDecoder::score_threshold(SCORE_SOFTMAX_LOGITS, 0.6f) - std::log(1.5f)) < 1e-6f, "logit threshold");
+    check(RetinaFaceDecoder::score_threshold(SCORE_SIGMOID_LOGIT, 0.f) == -INFINITY && RetinaFaceDecoder::score_threshold(SCORE_SIGMOID_LOGIT, 1.f) == INFINITY, "logit threshold bounds");
+    setenv("K230_DET_SCORE", "softmax", 1);
+    setenv("K230_FAST_EXP", "1", 1);
+    std::unique_ptr<RetinaFaceDecoder> from_env = RetinaFaceDecoder::from_env(640);
+    check(from_env->score_mode() == SCORE_SOFTMAX_LOGITS && from_env->use_fast_exp(), "decoder from env");
+    if (simu.conf.size() == 16800 * CONF_SIZE)
+        compare_score_modes("simulator 640", 640, simu);
+    compare_score_modes("random 320", 320, random_outputs(4200, 1));
+    compare_score_modes("random 640", 640, random_outputs(16800, 2));
+    compare_score_modes("random 480", 480, random_outputs(9450, 4));
+
+    cout << (g_ret ? "test_postprocess failed" : "test_postprocess passed") << endl;
+    return g_ret;
+}
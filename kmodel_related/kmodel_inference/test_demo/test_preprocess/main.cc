@@ -0,0 +1,193 @@
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <nncase/runtime/interpreter.h>
+#include "utils.h"
+#include "scoped_timing.hpp"
+
+using std::cout;
+using std::endl;
+using namespace nncase::runtime;
+
+#define FRAME_WIDTH (1280)
+#define FRAME_HEIGHT (720)
+#define NET_SIZE (640)
+#define LOOP_NUM (20)
+#define FACE_SIZE (112)
+
+// 生成一帧带渐变和噪声的nv12数据
+static void make_nv12_frame(vector<uint8_t> &nv12, int width, int height)
+{
+    nv12.resize(width * height * 3 / 2);
+    uint8_t *y_plane = nv12.data();
+    uint8_t *uv_plane = nv12.data() + width * height;
+    srand(0);
+    for (int h = 0; h < height; ++h)
+        for (int w = 0; w < width; ++w)
+            y_plane[h * width + w] = 16 + ((w + h) * 219 / (width + height)) + rand() % 8;
+    for (int h = 0; h < height / 2; ++h)
+        for (int w = 0; w < width / 2; ++w)
+        {
+            uv_plane[h * width + 2 * w] = 64 + w * 128 / (width / 2);
+            uv_plane[h * width + 2 * w + 1] = 64 + h * 128 / (height / 2);
+        }
+}
+
+static int g_ret = 0;
+
+// 比较两组uint8输出，最大差或平均差超过容差时判为失败
+static void compare(const char *info, const uint8_t *a, const uint8_t *b, size_t size, int max_tol, double mean_tol)
+{
+    int max_diff = 0;
+    double sum_diff = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        int diff = std::abs((int)a[i] - (int)b[i]);
+        max_diff = std::max(max_diff, diff);
+        sum_diff += diff;
+    }
+    double mean_diff = sum_diff / size;
+    bool ok = max_diff <= max_tol && mean_diff <= mean_tol;
+    cout << info << ": max diff = " << max_diff << ", mean diff = " << mean_diff << " (tolerance " << max_tol << ", " << mean_tol << ")"
+         << (ok ? "" : " FAIL") << endl;
+    if (!ok)
+        g_ret = -1;
+}
+
+int main(int argc, char *argv[])
+{
+    // 用法：test_preprocess.elf [ai2d]，带ai2d参数时（上板）同时校验ai2d nv12预处理和人脸affine结果
+    vector<uint8_t> nv12;
+    make_nv12_frame(nv12, FRAME_WIDTH, FRAME_HEIGHT);
+    FrameSize ori_size = {FRAME_WIDTH, FRAME_HEIGHT};
+    FrameSize resize_shape = {NET_SIZE, NET_SIZE};
+    cv::Scalar padding(123, 117, 104);
+    size_t out_size = 3 * NET_SIZE * NET_SIZE;
+
+    /**********************capture拷贝量：rgb888 planar vs nv12*************************/
+    {
+        vector<uint8_t> src(FRAME_WIDTH * FRAME_HEIGHT * 3), dst(FRAME_WIDTH * FRAME_HEIGHT * 3);
+        {
+            ScopedTiming st("copy rgb888 planar x20", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+                memcpy(dst.data(), src.data(), FRAME_WIDTH * FRAME_HEIGHT * 3);
+        }
+        {
+            ScopedTiming st("copy nv12 x20", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+                memcpy(dst.data(), src.data(), FRAME_WIDTH * FRAME_HEIGHT * 3 / 2);
+        }
+    }
+
+    /**********************cpu参考实现：nv12 -> padding resize -> rgb chw*************************/
+    vector<uint8_t> cpu_out(out_size);
+    {
+        ScopedTiming st("cpu nv12 padding_resize x20", 1);
+        for (int i = 0; i < LOOP_NUM; ++i)
+            Utils::nv12_padding_resize_one_side(nv12.data(), ori_size, resize_shape, cpu_out.data(), padding);
+    }
+
+    /**********************opencv对照：cvtColor(nv12->rgb) + resize + padding*************************/
+    vector<uint8_t> cv_out;
+    {
+        ScopedTiming st("opencv nv12 padding_resize x1", 1);
+        cv::Mat nv12_mat(FRAME_HEIGHT * 3 / 2, FRAME_WIDTH, CV_8UC1, nv12.data());
+        cv::Mat rgb;
+        cv::cvtColor(nv12_mat, rgb, cv::COLOR_YUV2RGB_NV12);
+        float ratio = std::min((float)NET_SIZE / FRAME_WIDTH, (float)NET_SIZE / FRAME_HEIGHT);
+        int new_w = (int)(ratio * FRAME_WIDTH);
+        int new_h = (int)(ratio * FRAME_HEIGHT);
+        cv::Mat resized;
+        cv::resize(rgb, resized, cv::Size(new_w, new_h), 0, 0, cv::INTER_LINEAR);
+        cv::copyMakeBorder(resized, resized, 0, NET_SIZE - new_h, 0, NET_SIZE - new_w, cv::BORDER_CONSTANT, padding);
+        Utils::hwc_to_chw(resized, cv_out);
+    }
+    // 定点插值与opencv的舍入不同，且cpu先缩放yuv再转rgb：实测max 2、mean 0.14
+    compare("cpu vs opencv", cpu_out.data(), cv_out.data(), out_size, 4, 0.5);
+    Utils::dump_color_image("nv12_cpu_padding_resize.png", resize_shape, cpu_out.data());
+
+    /**********************ai2d nv12预处理（上板）*************************/
+    if (argc > 1 && strcmp(argv[1], "ai2d") == 0)
+    {
+        dims_t in_shape{1, 1, FRAME_HEIGHT * 3 / 2, FRAME_WIDTH};
+        runtime_tensor ai2d_in_tensor = hrt::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("create ai2d input tensor failed");
+        dims_t out_shape{1, 3, NET_SIZE, NET_SIZE};
+        runtime_tensor ai2d_out_tensor = hrt::create(typecode_t::dt_uint8, out_shape, hrt::pool_shared).expect("create ai2d output tensor failed");
+
+        auto in_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
+        memcpy(reinterpret_cast<char *>(in_buf.data()), nv12.data(), nv12.size());
+        hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("sync write_back failed");
+
+        std::unique_ptr<ai2d_builder> builder;
+        Utils::padding_resize_one_side_nv12({3, FRAME_HEIGHT, FRAME_WIDTH}, resize_shape, builder, ai2d_in_tensor, ai2d_out_tensor, padding);
+        {
+            ScopedTiming st("ai2d nv12 padding_resize x20", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+                builder->invoke(ai2d_in_tensor, ai2d_out_tensor).expect("error occurred in ai2d running");
+        }
+
+        auto out_buf = ai2d_out_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_read).unwrap().buffer();
+        // ai2d的色彩转换系数、插值精度与cpu实现不同，容差放宽
+        compare("ai2d vs cpu", reinterpret_cast<uint8_t *>(out_buf.data()), cpu_out.data(), out_size, 16, 2.0);
+    }
+
+    /**********************人脸affine：整帧rgb chw -> 112*112*************************/
+    // 模拟画面中间约200像素宽、旋转约10度的人脸
+    float matrix[6] = {0.55f, -0.097f, -277.f, 0.097f, 0.55f, -246.f};
+    cv::Mat nv12_mat(FRAME_HEIGHT * 3 / 2, FRAME_WIDTH, CV_8UC1, nv12.data());
+    cv::Mat rgb;
+    cv::cvtColor(nv12_mat, rgb, cv::COLOR_YUV2RGB_NV12);
+    vector<uint8_t> frame_chw;
+    Utils::hwc_to_chw(rgb, frame_chw);
+    FrameCHWSize frame_shape = {3, FRAME_HEIGHT, FRAME_WIDTH};
+    FrameCHWSize face_shape = {3, FACE_SIZE, FACE_SIZE};
+    size_t face_size = 3 * FACE_SIZE * FACE_SIZE;
+
+    vector<uint8_t> cpu_face(face_size);
+    {
+        ScopedTiming st("cpu warp_affine 112 x20", 1);
+        for (int i = 0; i < LOOP_NUM; ++i)
+            Utils::warp_affine(frame_chw.data(), frame_shape, matrix, cpu_face.data(), face_shape);
+    }
+
+    vector<uint8_t> cv_face;
+    {
+        cv::Mat m(2, 3, CV_32FC1, matrix);
+        cv::Mat face;
+        cv::warpAffine(rgb, face, m, cv::Size(FACE_SIZE, FACE_SIZE), cv::INTER_LINEAR, cv::BORDER_CONSTANT, cv::Scalar(127, 127, 127));
+        Utils::hwc_to_chw(face, cv_face);
+    }
+    // opencv的affine插值权重为5位定点，cpu为10位：实测max 1、mean 0.005
+    compare("cpu warp_affine vs opencv", cpu_face.data(), cv_face.data(), face_size, 2, 0.1);
+    Utils::dump_color_image("cpu_warp_affine.png", {FACE_SIZE, FACE_SIZE}, cpu_face.data());
+
+    if (argc > 1 && strcmp(argv[1], "ai2d") == 0)
+    {
+        dims_t in_shape{1, 3, FRAME_HEIGHT, FRAME_WIDTH};
+        runtime_tensor ai2d_in_tensor = hrt::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("create ai2d input tensor failed");
+        dims_t out_shape{1, 3, FACE_SIZE, FACE_SIZE};
+        runtime_tensor ai2d_out_tensor = hrt::create(typecode_t::dt_uint8, out_shape, hrt::pool_shared).expect("create ai2d output tensor failed");
+
+        auto in_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
+        memcpy(reinterpret_cast<char *>(in_buf.data()), frame_chw.data(), frame_chw.size());
+        hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("sync write_back failed");
+
+        // FaceRecognition(AFFINE_AI2D)每个人脸都要走一遍：构造ai2d_builder + build_schedule + invoke
+        std::unique_ptr<ai2d_builder> builder;
+        {
+            ScopedTiming st("ai2d affine build+invoke x20", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+                Utils::affine(matrix, builder, ai2d_in_tensor, ai2d_out_tensor);
+        }
+        {
+            ScopedTiming st("ai2d affine invoke only x20", 1);
+            for (int i = 0; i < LOOP_NUM; ++i)
+                builder->invoke(ai2d_in_tensor, ai2d_out_tensor).expect("error occurred in ai2d running");
+        }
+
+        auto out_buf = ai2d_out_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_read).unwrap().buffer();
+        compare("ai2d affine vs cpu warp_affine", reinterpret_cast<uint8_t *>(out_buf.data()), cpu_face.data(), face_size, 8, 1.0);
+    }
+    cout << (g_ret ? "test_preprocess failed" : "test_preprocess passed") << endl;
+    return g_ret;
+}
@@ -0,0 +1,143 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include "scoped_timing.hpp"
+
+using std::cout;
+using std::endl;
+
+static void busy_wait_us(int us)
+{
+    auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+    while (std::chrono::steady_clock::now() < end)
+        ;
+}
+
+// 模拟一帧：total time下嵌套pre_process/run，同名run在不同父节点下分别统计
+static void fake_frame(int i)
+{
+    ScopedTiming st("total time", 0);
+    {
+        ScopedTiming st("pre_process", 0);
+        busy_wait_us(100);
+    }
+    {
+        ScopedTiming st("run", 0);
+        busy_wait_us(i % 20 == 0 ? 2000 : 300); // 5%的长尾帧
+    }
+}
+
+static double ns_per_call(int iters)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; ++i)
+    {
+        ScopedTiming st("empty", 0);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / iters;
+}
+
+int main()
+{
+    Profiler &profiler = Profiler::instance();
+    int ret = 0;
+
+#if K230_PROFILER
+    if (profiler.enabled())
+    {
+        cout << "unset K230_PROFILE before running this test" << endl;
+        return -1;
+    }
+#endif
+
+    // 未开启时ScopedTiming(…, 0)的开销
+    const int iters = 200000;
+    double off_ns = ns_per_call(iters);
+    profiler.enable(0);
+    double on_ns = ns_per_call(iters);
+    profiler.collect(); // 丢弃上面的空作用域采样
+    cout << "ScopedTiming per call: disabled " << off_ns << " ns, enabled " << on_ns << " ns" << endl;
+
+#if K230_PROFILER
+    // 两个线程同时记录，同一节点的采样合并统计；先跑一帧使主线程的节点编号在前
+    const int frames = 200;
+    fake_frame(0);
+    std::thread worker([&] {
+        ScopedTiming st("worker", 0);
+        ScopedTiming st2("run", 0);
+        busy_wait_us(50);
+    });
+    for (int i = 1; i < frames; ++i)
+        fake_frame(i);
+    worker.join();
+
+    std::vector<ProfileStat> stats = profiler.collect();
+    for (const ProfileStat &st : stats)
+        cout << std::string(st.depth * 2, ' ') << st.name << " count " << st.count << " min " << st.min_ms
+             << " mean " << st.mean_ms << " p50 " << st.p50_ms << " p95 " << st.p95_ms << " p99 " << st.p99_ms << endl;
+
+    // 先序：total time, pre_process, run, worker, run
+    const char *names[] = {"total time", "pre_process", "run", "worker", "run"};
+    const int depths[] = {0, 1, 1, 0, 1};
+    const size_t counts[] = {frames, frames, frames, 1, 1};
+    if (stats.size() != 5)
+    {
+        cout << "unexpected node number " << stats.size() << endl;
+        return -1;
+    }
+    for (int i = 0; i < 5; ++i)
+    {
+        if (stats[i].name != names[i] || stats[i].depth != depths[i] || stats[i].count != counts[i])
+        {
+            cout << "node " << i << " mismatch" << endl;
+            ret = -1;
+        }
+        if (!(stats[i].min_ms <= stats[i].p50_ms && stats[i].p50_ms <= stats[i].p95_ms && stats[i].p95_ms <= stats[i].p99_ms))
+        {
+            cout << "node " << i << " percentiles not ordered" << endl;
+            ret = -1;
+        }
+    }
+    // run的p50落在300us附近，p99落在2ms长尾
+    if (stats[2].p50_ms > 1.0f || stats[2].p99_ms < 1.9f)
+    {
+        cout << "run percentiles out of range" << endl;
+        ret = -1;
+    }
+    // 统计周期结束后清空
+    if (!profiler.collect().empty())
+    {
+        cout << "samples not cleared after collect" << endl;
+        ret = -1;
+    }
+
+    // 只在退出时打印（K230_PROFILE=0）：每帧取走环形缓冲区的采样，超过缓冲区大小的采样不丢失
+    const int long_frames = 3000;
+    for (int i = 0; i < long_frames; ++i)
+    {
+        {
+            ScopedTiming st("long run", 0);
+            ScopedTiming st2("step a", 0);
+        }
+        {
+            ScopedTiming st("step b", 0);
+        }
+        profiler.frame();
+    }
+    stats = profiler.collect();
+    size_t long_samples = 0;
+    for (const ProfileStat &st : stats)
+        long_samples += st.count;
+    cout << long_frames << " frames without report: " << long_samples << " samples" << endl;
+    if (long_samples != 3 * long_frames)
+    {
+        cout << "samples dropped when reporting only at exit" << endl;
+        ret = -1;
+    }
+#endif
+
+    cout << (ret ? "test_profiler failed" : "test_profiler passed") << endl;
+    return ret;
+}
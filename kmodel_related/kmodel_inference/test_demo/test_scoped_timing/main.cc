@@ -1,9 +1,46 @@
 #include <iostream>
+#include <cstdlib>
+#include <new>
 #include "scoped_timing.hpp"
 
 using std::cout;
 using std::endl;
 
+// 统计堆分配次数，用于确认TimingLabel版本的ScopedTiming不分配内存
+static size_t g_alloc_count = 0;
+
+void *operator new(size_t size)
+{
+    g_alloc_count++;
+    void *p = malloc(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+template <class F>
+static void bench(const char *name, F f)
+{
+    const int iters = 1000000;
+    size_t allocs = g_alloc_count;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; ++i)
+        f();
+    auto stop = std::chrono::steady_clock::now();
+    cout << name << ": " << std::chrono::duration<double, std::nano>(stop - start).count() / iters << " ns/call, "
+         << (double)(g_alloc_count - allocs) / iters << " allocs/call" << endl;
+}
+
 int main()
 {
     // ScopedTiming对象创建时开始计时，销毁时结束计时
@@ -35,5 +72,18 @@ int main()
 
     // 第一个ScopedTiming对象，`debug_mode = 1`出作用域时，打印了test 1部分的耗时；
     // 第二个ScopedTiming对象，`debug_mode = 0`出作用域时，并未打印耗时
+
+    // 每次调用的开销：AIBase::run原先每次拼接model_name_ + " run"，现在使用构造时登记好的TimingLabel
+    cout << endl;
+    std::string model_name = "FaceRecognition";
+    TimingLabel run_label(model_name + " run");
+    bench("string label, disabled ", [&] { ScopedTiming st(model_name + " run", 0); });
+    bench("TimingLabel,  disabled ", [&] { ScopedTiming st(run_label, 0); });
+    if (!Profiler::instance().enabled())
+        Profiler::instance().enable(0);
+    // 环形缓冲区写满后的采样会被丢弃，不影响单次调用的开销
+    bench("string label, profiler ", [&] { ScopedTiming st(model_name + " run", 0); });
+    bench("TimingLabel,  profiler ", [&] { ScopedTiming st(run_label, 0); });
+    Profiler::instance().collect();
     return 0;
 }
\ No newline at end of file
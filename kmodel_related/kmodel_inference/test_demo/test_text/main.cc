@@ -0,0 +1,93 @@
+#include <iostream>
+#include <cstdio>
+#include <opencv2/imgproc.hpp>
+#include "text_renderer.h"
+#include "scoped_timing.hpp"
+
+using std::cout;
+using std::endl;
+
+#define OSD_WIDTH (1920)
+#define OSD_HEIGHT (1080)
+#define LOOP_NUM (20)
+
+typedef struct TextStyle
+{
+    const char *info;
+    double font_scale;
+    int thickness;
+    cv::Scalar color;
+} TextStyle;
+
+// 生成和draw_result相同格式的文字：检测得分、人名:得分、unknown
+static std::vector<std::string> make_labels(int num)
+{
+    const char *names[] = {"zhangsan", "lisi", "wangwu", "unknown"};
+    std::vector<std::string> labels;
+    char text[30];
+    for (int i = 0; i < num; ++i)
+    {
+        float score = 0.5f + (i % 50) / 100.f;
+        if (i % 3 == 0)
+            sprintf(text, "%.2f", score);
+        else if (i % 4 == 3)
+            sprintf(text, "unknown");
+        else
+            sprintf(text, "%s:%.2f", names[i % 3], score);
+        labels.push_back(text);
+    }
+    return labels;
+}
+
+static cv::Point label_pos(int i)
+{
+    return cv::Point(20 + (i % 6) * 310, 80 + (i / 6) * 120);
+}
+
+int main(int argc, char *argv[])
+{
+    // 用法：test_text.elf [label_num]
+    int label_num = argc > 1 ? atoi(argv[1]) : 48;
+    std::vector<std::string> labels = make_labels(label_num);
+    // FaceDetection（得分）和FaceRecognition（人名）osd上使用的两种样式
+    TextStyle styles[] = {{"det score", 0.5, 1, cv::Scalar(255, 0, 255, 255)}, {"recg name", 2.0, 2, cv::Scalar(255, 255, 0, 255)}};
+
+    for (auto &style : styles)
+    {
+        cv::Mat cv_img(OSD_HEIGHT, OSD_WIDTH, CV_8UC4, cv::Scalar(0, 0, 0, 0));
+        cv::Mat glyph_img(OSD_HEIGHT, OSD_WIDTH, CV_8UC4, cv::Scalar(0, 0, 0, 0));
+        {
+            ScopedTiming st(std::string(style.info) + " cv::putText x20", 1);
+            for (int n = 0; n < LOOP_NUM; ++n)
+                for (int i = 0; i < label_num; ++i)
+                    cv::putText(cv_img, labels[i], label_pos(i), cv::FONT_HERSHEY_COMPLEX, style.font_scale, style.color, style.thickness, cv::LINE_8, false);
+        }
+
+        TextRenderer renderer;
+        {
+            ScopedTiming st(std::string(style.info) + " TextRenderer first call (build atlas)", 1);
+            renderer.draw(glyph_img, labels[0], label_pos(0), cv::FONT_HERSHEY_COMPLEX, style.font_scale, style.color, style.thickness);
+        }
+        {
+            ScopedTiming st(std::string(style.info) + " TextRenderer x20", 1);
+            for (int n = 0; n < LOOP_NUM; ++n)
+                for (int i = 0; i < label_num; ++i)
+                    renderer.draw(glyph_img, labels[i], label_pos(i), cv::FONT_HERSHEY_COMPLEX, style.font_scale, style.color, style.thickness);
+        }
+
+        // 字形按整数像素放置，putText按亚像素累加笔位置，允许少量像素差异
+        size_t text_pixels = 0, diff_pixels = 0;
+        for (int y = 0; y < OSD_HEIGHT; ++y)
+        {
+            const uint32_t *a = cv_img.ptr<uint32_t>(y);
+            const uint32_t *b = glyph_img.ptr<uint32_t>(y);
+            for (int x = 0; x < OSD_WIDTH; ++x)
+            {
+                text_pixels += a[x] != 0;
+                diff_pixels += a[x] != b[x];
+            }
+        }
+        cout << style.info << ": text pixels = " << text_pixels << ", different pixels = " << diff_pixels << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <chrono>
+#include <map>
+#include <set>
+#include <atomic>
+#include "scoped_timing.hpp"
+#include "latest_mailbox.hpp"
+
+using std::cout;
+using std::endl;
+
+// 取json行中"key":后面的值（字符串去掉引号）
+static std::string field(const std::string &line, const std::string &key)
+{
+    std::string pattern = "\"" + key + "\":";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos)
+        return "";
+    pos += pattern.size();
+    if (line[pos] == '"')
+        return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+    size_t end = line.find_first_of(",}", pos);
+    return line.substr(pos, end - pos);
+}
+
+int main(int argc, char *argv[])
+{
+#if K230_PROFILER
+    // 用两个线程模拟采集/推理与osd流水线，检查输出的时间线：每个线程B/E配对，osd的帧号都来自采集
+    std::string file = argc > 1 ? argv[1] : "test_trace.json";
+    TraceRecorder &trace = TraceRecorder::instance();
+    trace.enable(file);
+
+    const int frames = 50;
+    LatestMailbox<int> mailbox;
+    std::atomic<bool> stop(false);
+    std::thread thread_osd([&]() {
+        trace.set_thread_name("osd");
+        while (!stop)
+        {
+            if (mailbox.update())
+            {
+                ScopedTiming st("osd draw", 0);
+                trace.flow_end(mailbox.read_tag());
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+    });
+
+    trace.set_thread_name("inference");
+    for (unsigned long frame_id = 1; frame_id <= frames; ++frame_id)
+    {
+        ScopedTiming st("total time", 0);
+        {
+            ScopedTiming st("read capture", 0);
+            trace.flow_begin(frame_id);
+        }
+        {
+            ScopedTiming st("FaceDetection run", 0);
+            std::this_thread::sleep_for(std::chrono::microseconds(300));
+        }
+        trace.flow_step(frame_id);
+        mailbox.write_slot() = (int)frame_id;
+        mailbox.publish(frame_id);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    stop = true;
+    thread_osd.join();
+
+    if (!trace.write())
+        return -1;
+
+    std::ifstream ifs(file);
+    std::string line;
+    std::map<std::string, int> depth;      // tid -> 当前嵌套层数
+    std::map<std::string, std::string> names; // tid -> 线程名
+    std::set<std::string> begin_ids, end_ids;
+    int ret = 0, events = 0, steps = 0;
+    std::getline(ifs, line);
+    if (line.find("traceEvents") == std::string::npos)
+    {
+        cout << "missing traceEvents" << endl;
+        return -1;
+    }
+    while (std::getline(ifs, line))
+    {
+        std::string ph = field(line, "ph");
+        std::string tid = field(line, "tid");
+        if (ph.empty())
+            continue;
+        events++;
+        if (ph == "M")
+            names[tid] = line.substr(line.rfind(":\"") + 2, line.rfind("\"}}") - line.rfind(":\"") - 2);
+        else if (ph == "B")
+            depth[tid]++;
+        else if (ph == "E" && --depth[tid] < 0)
+            ret = -1;
+        else if (ph == "s")
+            begin_ids.insert(field(line, "id"));
+        else if (ph == "t")
+            steps++;
+        else if (ph == "f")
+        {
+            end_ids.insert(field(line, "id"));
+            if (field(line, "bp") != "e" || depth[tid] <= 0)
+                ret = -1; // 终点必须落在osd draw区间内
+        }
+    }
+    for (auto &d : depth)
+        if (d.second != 0)
+            ret = -1;
+    for (auto &id : end_ids)
+        if (!begin_ids.count(id))
+            ret = -1;
+    cout << events << " events, " << names.size() << " threads, " << begin_ids.size() << " frames captured, "
+         << end_ids.size() << " frames drawn" << endl;
+    if (names.size() != 2 || begin_ids.size() != frames || steps != frames || end_ids.empty())
+        ret = -1;
+    cout << (ret ? "test_trace failed" : "test_trace passed") << ", open " << file << " in chrome://tracing or ui.perfetto.dev" << endl;
+    return ret;
+#else
+    cout << "built with K230_PROFILER=0, trace recorder disabled" << endl;
+    return 0;
+#endif
+}
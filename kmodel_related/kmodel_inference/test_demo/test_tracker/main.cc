@@ -0,0 +1,198 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+#include "face_tracker.h"
+
+using std::cout;
+using std::endl;
+
+static int g_ret = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        cout << "FAIL: " << what << endl;
+        g_ret = -1;
+    }
+}
+
+// 一帧的检测结果，truth为每个检测对应的真实人物编号（-1为误检），从文件回放时全为-1
+struct ReplayFrame
+{
+    std::vector<FaceDetectionInfo> dets;
+    std::vector<int> truth;
+};
+
+static FaceDetectionInfo make_det(float x, float y, float w, float h, float score)
+{
+    FaceDetectionInfo det;
+    det.bbox = {x, y, w, h};
+    for (int i = 0; i < 5; i++)
+    {
+        det.sparse_kps.points[2 * i] = x + w * (0.3f + 0.1f * i);
+        det.sparse_kps.points[2 * i + 1] = y + h * 0.5f;
+    }
+    det.score = score;
+    return det;
+}
+
+// 合成场景（30fps，10秒）：A全程静止，B从左走到右，C中途出现、偶尔漏检并有一段侧脸（置信度下降），另有零星单帧误检
+static std::vector<ReplayFrame> synthetic_scene()
+{
+    std::mt19937 rng(230);
+    std::normal_distribution<float> jitter(0.f, 1.5f);
+    std::uniform_real_distribution<float> uniform(0.f, 1.f);
+    std::vector<ReplayFrame> frames(300);
+    for (int f = 0; f < (int)frames.size(); f++)
+    {
+        ReplayFrame &frame = frames[f];
+        frame.dets.push_back(make_det(800 + jitter(rng), 400 + jitter(rng), 120 + jitter(rng), 150 + jitter(rng), 0.9f));
+        frame.truth.push_back(0);
+        if (f < 200)
+        {
+            frame.dets.push_back(make_det(100 + f * 6 + jitter(rng), 300 + jitter(rng), 100, 125, 0.85f));
+            frame.truth.push_back(1);
+        }
+        if (f >= 100 && uniform(rng) > 0.05f)
+        {
+            float score = f >= 180 && f < 190 ? 0.6f : 0.88f;
+            frame.dets.push_back(make_det(1400 - (f - 100) * 2 + jitter(rng), 500 + jitter(rng), 90, 110, score));
+            frame.truth.push_back(2);
+        }
+        if (uniform(rng) < 0.02f)
+        {
+            frame.dets.push_back(make_det(uniform(rng) * 1800, uniform(rng) * 900, 60, 70, 0.55f));
+            frame.truth.push_back(-1);
+        }
+    }
+    return frames;
+}
+
+// 回放文件每行：帧号 x y w h score，帧号递增
+static std::vector<ReplayFrame> load_replay(const char *path)
+{
+    std::vector<ReplayFrame> frames;
+    std::ifstream ifs(path);
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+        std::istringstream iss(line);
+        int f;
+        float x, y, w, h, score;
+        if (!(iss >> f >> x >> y >> w >> h >> score) || f < 0)
+            continue;
+        if (f >= (int)frames.size())
+            frames.resize(f + 1);
+        frames[f].dets.push_back(make_det(x, y, w, h, score));
+        frames[f].truth.push_back(-1);
+    }
+    return frames;
+}
+
+struct ReplayResult
+{
+    int detections;                        // 每帧每张人脸都识别时的识别次数
+    int recognitions;                      // 跟踪后实际识别次数
+    int tracks;                            // 产生的轨迹数
+    std::map<int, std::set<int>> truth_ids; // 真实人物 -> 对应过的轨迹ID
+};
+
+static ReplayResult replay(const std::vector<ReplayFrame> &frames, int recognize_period)
+{
+    ReplayResult result = {0, 0, 0, {}};
+    FaceTracker tracker(0.3f, 5, 1, recognize_period, 0.15f);
+    int max_id = 0;
+    for (auto &frame : frames)
+    {
+        result.detections += frame.dets.size();
+        for (auto &track : tracker.update(frame.dets))
+        {
+            max_id = std::max(max_id, track.id);
+            if (track.time_since_update != 0)
+                continue;
+            if (tracker.needs_recognition(track))
+            {
+                result.recognitions++;
+                tracker.set_identity(track, track.id, 0.9f, "person");
+            }
+            // 用检测框找回真实人物编号
+            for (size_t d = 0; d < frame.dets.size(); d++)
+            {
+                if (frame.truth[d] >= 0 && memcmp(&frame.dets[d].bbox, &track.det.bbox, sizeof(Bbox)) == 0)
+                    result.truth_ids[frame.truth[d]].insert(track.id);
+            }
+        }
+    }
+    result.tracks = max_id;
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    // 卡尔曼：匀速运动的框，预测应跟上
+    KalmanBox kf({100, 100, 50, 60});
+    for (int i = 1; i <= 20; i++)
+    {
+        kf.predict();
+        kf.update({100.f + i * 5, 100, 50, 60});
+    }
+    Bbox next = kf.predict();
+    check(std::fabs(next.x - 205) < 2 && std::fabs(next.w - 50) < 2 && std::fabs(next.h - 60) < 2, "kalman constant velocity");
+    check(std::fabs(FaceTracker::iou({0, 0, 10, 10}, {5, 0, 10, 10}) - 1.f / 3) < 1e-6 && FaceTracker::iou({0, 0, 10, 10}, {20, 20, 5, 5}) == 0, "iou");
+
+    // 识别策略：新轨迹识别一次，周期到了或置信度下降再识别
+    FaceTracker tracker(0.3f, 5, 1, 10, 0.15f);
+    std::vector<FaceDetectionInfo> dets = {make_det(100, 100, 80, 100, 0.9f)};
+    FaceTrack &track = tracker.update(dets)[0];
+    check(tracker.needs_recognition(track), "new track needs recognition");
+    tracker.set_identity(track, 3, 0.8f, "alice");
+    int rerun_at = -1;
+    for (int f = 1; f <= 10 && rerun_at < 0; f++)
+    {
+        if (tracker.needs_recognition(tracker.update(dets)[0]))
+            rerun_at = f;
+    }
+    check(rerun_at == 10, "periodic re-recognition");
+    tracker.set_identity(tracker.tracks()[0], 3, 0.8f, "alice");
+    dets[0].score = 0.7f;
+    check(tracker.needs_recognition(tracker.update(dets)[0]), "re-recognition on confidence drop");
+    check(tracker.tracks()[0].identity_name == "alice" && tracker.tracks()[0].id == 1, "identity cached on track");
+    for (int f = 0; f < 6; f++)
+        tracker.update({});
+    check(tracker.tracks().empty(), "track expires after max_age");
+
+    // 回放：合成场景或命令行给出的检测结果文件
+    bool synthetic = argc < 2;
+    std::vector<ReplayFrame> frames = synthetic ? synthetic_scene() : load_replay(argv[1]);
+    ReplayResult result = replay(frames, 30);
+    cout << "replay " << frames.size() << " frames: " << result.detections << " detections, " << result.tracks << " tracks, "
+         << result.recognitions << " recognitions (" << (float)result.detections / std::max(result.recognitions, 1) << "x fewer)" << endl;
+    if (synthetic)
+    {
+        check(result.detections >= 10 * result.recognitions, "recognitions cut by an order of magnitude");
+        for (auto &kv : result.truth_ids)
+        {
+            cout << "person " << kv.first << ": " << kv.second.size() << " track id(s)" << endl;
+            check(kv.second.size() == 1, "no id switch for person " + std::to_string(kv.first));
+        }
+    }
+
+    // 耗时：tracker本身相对识别kmodel可忽略
+    const int loops = 100;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++)
+        replay(frames, 30);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    cout << "tracker update: " << us / loops / std::max<size_t>(frames.size(), 1) << " us/frame" << endl;
+
+    cout << (g_ret ? "test_tracker failed" : "test_tracker passed") << endl;
+    return g_ret;
+}
@@ -1,402 +0,0 @@
-/* Copyright (c) 2023, Canaan Bright Sight Co., Ltd
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- * 1. Redistributions of source code must retain the above copyright
- * notice, this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright
- * notice, this list of conditions and the following disclaimer in the
- * documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
- * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
- * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
- * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
- * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
- * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
- * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
- * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
- * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
- * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- */
-// utils.cpp
-#include <iostream>
-#include "utils.h"
-
-using std::ofstream;
-using std::vector;
-auto cache = cv::Mat::zeros(1, 1, CV_32FC1);
-void Utils::dump_binary_file(const char *file_name, char *data, const size_t size)
-{
-    // eg:Utils::dump_binary_file(out_name.c_str(),reinterpret_cast<char *>(p_outputs_[i]),each_output_size_by_byte_[i+1]-each_output_size_by_byte_[i]);
-    std::ofstream outf;
-    outf.open(file_name, std::ofstream::binary);
-    outf.write(data, size);
-    outf.close();
-}
-
-void Utils::dump_gray_image(const char *file_name, const FrameSize &frame_size, unsigned char *data)
-{
-    cv::Mat gray_image = cv::Mat(frame_size.height, frame_size.width, CV_8UC1, data);
-    cv::imwrite(file_name, gray_image);
-}
-
-void Utils::dump_color_image(const char *file_name, const FrameSize &frame_size, unsigned char *data)
-{
-    cv::Mat image_r = cv::Mat(frame_size.height, frame_size.width, CV_8UC1, data);
-    cv::Mat image_g = cv::Mat(frame_size.height, frame_size.width, CV_8UC1, data+frame_size.height*frame_size.width);
-    cv::Mat image_b = cv::Mat(frame_size.height, frame_size.width, CV_8UC1, data+2*frame_size.height*frame_size.width);
-    
-    std::vector<cv::Mat> color_vec(3);
-    color_vec.clear();
-    color_vec.push_back(image_b);
-    color_vec.push_back(image_g);
-    color_vec.push_back(image_r);
-
-    cv::Mat color_img;
-    cv::merge(color_vec, color_img);
-    cv::imwrite(file_name, color_img);
-}
-
-cv::Mat Utils::padding_resize(const cv::Mat img, const FrameSize &frame_size, const cv::Scalar &padding)
-{
-    // width:dst_width
-    int ori_w = img.cols;
-    int ori_h = img.rows;
-    float ratiow = (float)frame_size.width / ori_w;
-    float ratioh = (float)frame_size.height / ori_h;
-    float ratio = ratiow < ratioh ? ratiow : ratioh;
-    int new_w = (int)(ratio * ori_w);
-    int new_h = (int)(ratio * ori_h);
-    float dw = (float)(frame_size.width - new_w) / 2;
-    float dh = (float)(frame_size.height - new_h) / 2;
-    int top = (int)(roundf(0 - 0.1));
-    int bottom = (int)(roundf(dh * 2 + 0.1));
-    int left = (int)(roundf(0 - 0.1));
-    int right = (int)(roundf(dw * 2 - 0.1));
-    cv::Mat cropped_img;
-    {
-        if ((new_w != frame_size.width) || (new_h != frame_size.height))
-        {
-            cv::resize(img, cropped_img, cv::Size(new_w, new_h), cv::INTER_AREA);
-        }
-    }
-    {
-        // 104, 117, 123,BGR
-        cv::copyMakeBorder(cropped_img, cropped_img, top, bottom, left, right, cv::BORDER_CONSTANT, padding);
-    }
-    return cropped_img;
-}
-
-cv::Mat Utils::resize(const cv::Mat img, const FrameSize &frame_size)
-{
-    cv::Mat cropped_img;
-    cv::resize(img, cropped_img, cv::Size(frame_size.width, frame_size.height), cv::INTER_LINEAR);
-    return cropped_img;
-}
-
-cv::Mat Utils::bgr_to_rgb(cv::Mat ori_img)
-{
-    cv::Mat rgb_img;
-    cv::cvtColor(ori_img, rgb_img, cv::COLOR_BGR2RGB);
-    return rgb_img;
-}
-
-void Utils::hwc_to_chw(cv::Mat &ori_img, std::vector<uint8_t> &chw_vec)
-{
-    // for rgb format
-    std::vector<cv::Mat> rgbChannels(3);
-    cv::split(ori_img, rgbChannels);
-    for (auto i = 0; i < rgbChannels.size(); i++)
-    {
-        std::vector<uint8_t> data = std::vector<uint8_t>(rgbChannels[i].reshape(1, 1));
-        chw_vec.insert(chw_vec.end(), data.begin(), data.end());
-    }
-}
-
-void Utils::bgr2rgb_and_hwc2chw(cv::Mat &ori_img, std::vector<uint8_t> &chw_vec)
-{
-    // for bgr format
-    std::vector<cv::Mat> bgrChannels(3);
-    cv::split(ori_img, bgrChannels);
-    for (auto i = 2; i > -1; i--)
-    {
-        std::vector<uint8_t> data = std::vector<uint8_t>(bgrChannels[i].reshape(1, 1));
-        chw_vec.insert(chw_vec.end(), data.begin(), data.end());
-    }
-}
-
-void Utils::resize(FrameCHWSize ori_shape, std::vector<uint8_t> &chw_vec, runtime_tensor &ai2d_out_tensor)
-{
-    // build ai2d_in_tensor
-    dims_t in_shape{1, ori_shape.channel, ori_shape.height, ori_shape.width};
-    runtime_tensor ai2d_in_tensor = host_runtime_tensor::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("cannot create input tensor");
-
-    auto input_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-    memcpy(reinterpret_cast<char *>(input_buf.data()), chw_vec.data(), chw_vec.size());
-    hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("write back input failed");
-
-    // run ai2d
-    // ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, typecode_t::dt_uint8, typecode_t::dt_uint8};
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param { false, 30, 20, 400, 600 };
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{false, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, ai2d_pad_mode::constant, {114, 114, 114}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t out_shape = ai2d_out_tensor.shape();
-    ai2d_builder builder { in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param };
-    builder.build_schedule();
-    builder.invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::resize(std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor)
-{
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param { false, 30, 20, 400, 600 };
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{false, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, ai2d_pad_mode::constant, {114, 114, 114}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t in_shape = ai2d_in_tensor.shape();
-    dims_t out_shape = ai2d_out_tensor.shape();
-    builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
-    builder->build_schedule();
-    builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::crop_resize(FrameCHWSize ori_shape, std::vector<uint8_t> &chw_vec, Bbox &crop_info, runtime_tensor &ai2d_out_tensor)
-{
-    // build ai2d_in_tensor
-    dims_t in_shape{1, ori_shape.channel, ori_shape.height, ori_shape.width};
-    runtime_tensor ai2d_in_tensor = host_runtime_tensor::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("cannot create input tensor");
-
-    auto input_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-    memcpy(reinterpret_cast<char *>(input_buf.data()), chw_vec.data(), chw_vec.size());
-    hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("write back input failed");
-
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{true, crop_info.x, crop_info.y, crop_info.w, crop_info.h};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{false, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, ai2d_pad_mode::constant, {114, 114, 114}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t out_shape = ai2d_out_tensor.shape();
-    ai2d_builder builder { in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param };
-    builder.build_schedule();
-    builder.invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::crop_resize(Bbox &crop_info, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor)
-{
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{true, crop_info.x, crop_info.y, crop_info.w, crop_info.h};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{false, {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, ai2d_pad_mode::constant, {114, 114, 114}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t in_shape = ai2d_in_tensor.shape();
-    dims_t out_shape = ai2d_out_tensor.shape();
-    builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
-    builder->build_schedule();
-    builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::padding_resize(FrameCHWSize ori_shape, std::vector<uint8_t> &chw_vec, FrameSize resize_shape, runtime_tensor &ai2d_out_tensor, cv::Scalar padding)
-{
-    int ori_w = ori_shape.width;
-    int ori_h = ori_shape.height;
-    int width = resize_shape.width;
-    int height = resize_shape.height;
-    float ratiow = (float)width / ori_w;
-    float ratioh = (float)height / ori_h;
-    float ratio = ratiow < ratioh ? ratiow : ratioh;
-    int new_w = (int)(ratio * ori_w);
-    int new_h = (int)(ratio * ori_h);
-    float dw = (float)(width - new_w) / 2;
-    float dh = (float)(height - new_h) / 2;
-    int top = (int)(roundf(dh - 0.1));
-    int bottom = (int)(roundf(dh + 0.1));
-    int left = (int)(roundf(dw - 0.1));
-    int right = (int)(roundf(dw - 0.1));
-
-    // create input
-    dims_t in_shape{1, ori_shape.channel, ori_h, ori_w};
-    auto ai2d_in_tensor = host_runtime_tensor::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("cannot create input tensor");
-    auto input_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-    memcpy(reinterpret_cast<char *>(input_buf.data()), chw_vec.data(), chw_vec.size());
-    hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("write back input failed");
-
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{true, {{0, 0}, {0, 0}, {top, bottom}, {left, right}}, ai2d_pad_mode::constant, {padding[0], padding[1], padding[2]}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t out_shape = ai2d_out_tensor.shape();
-    ai2d_builder builder { in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param };
-    builder.build_schedule();
-    builder.invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::padding_resize_one_side(FrameCHWSize ori_shape, std::vector<uint8_t> &chw_vec, FrameSize resize_shape, runtime_tensor &ai2d_out_tensor, cv::Scalar padding)
-{
-    int ori_w = ori_shape.width;
-    int ori_h = ori_shape.height;
-    int width = resize_shape.width;
-    int height = resize_shape.height;
-    float ratiow = (float)width / ori_w;
-    float ratioh = (float)height / ori_h;
-    float ratio = ratiow < ratioh ? ratiow : ratioh;
-    int new_w = (int)(ratio * ori_w);
-    int new_h = (int)(ratio * ori_h);
-    float dw = (float)(width - new_w) / 2;
-    float dh = (float)(height - new_h) / 2;
-    int top = (int)(roundf(0));
-    int bottom = (int)(roundf(dh * 2 + 0.1));
-    int left = (int)(roundf(0));
-    int right = (int)(roundf(dw * 2 - 0.1));
-
-    // create input
-    dims_t in_shape{1, ori_shape.channel, ori_h, ori_w};
-    auto ai2d_in_tensor = host_runtime_tensor::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("cannot create input tensor");
-    auto input_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-    memcpy(reinterpret_cast<char *>(input_buf.data()), chw_vec.data(), chw_vec.size());
-    hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("write back input failed");
-
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{true, {{0, 0}, {0, 0}, {top, bottom}, {left, right}}, ai2d_pad_mode::constant, {padding[0], padding[1], padding[2]}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t out_shape = ai2d_out_tensor.shape();
-    ai2d_builder builder { in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param };
-    builder.build_schedule();
-    builder.invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::padding_resize(FrameCHWSize ori_shape, FrameSize resize_shape, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor, const cv::Scalar padding)
-{
-    int ori_w = ori_shape.width;
-    int ori_h = ori_shape.height;
-    int width = resize_shape.width;
-    int height = resize_shape.height;
-    float ratiow = (float)width / ori_w;
-    float ratioh = (float)height / ori_h;
-    float ratio = ratiow < ratioh ? ratiow : ratioh;
-    int new_w = (int)(ratio * ori_w);
-    int new_h = (int)(ratio * ori_h);
-    float dw = (float)(width - new_w) / 2;
-    float dh = (float)(height - new_h) / 2;
-    int top = (int)(roundf(dh - 0.1));
-    int bottom = (int)(roundf(dh + 0.1));
-    int left = (int)(roundf(dw - 0.1));
-    int right = (int)(roundf(dw - 0.1));
-
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{true, {{0, 0}, {0, 0}, {top, bottom}, {left, right}}, ai2d_pad_mode::constant, {padding[0], padding[1], padding[2]}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t in_shape = ai2d_in_tensor.shape();
-    dims_t out_shape = ai2d_out_tensor.shape();
-    builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
-    builder->build_schedule();
-    builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::padding_resize_one_side(FrameCHWSize ori_shape, FrameSize resize_shape, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor, const cv::Scalar padding)
-{
-    int ori_w = ori_shape.width;
-    int ori_h = ori_shape.height;
-    int width = resize_shape.width;
-    int height = resize_shape.height;
-    float ratiow = (float)width / ori_w;
-    float ratioh = (float)height / ori_h;
-    float ratio = ratiow < ratioh ? ratiow : ratioh;
-    int new_w = (int)(ratio * ori_w);
-    int new_h = (int)(ratio * ori_h);
-    float dw = (float)(width - new_w) / 2;
-    float dh = (float)(height - new_h) / 2;
-    int top = (int)(roundf(0));
-    int bottom = (int)(roundf(dh * 2 + 0.1));
-    int left = (int)(roundf(0));
-    int right = (int)(roundf(dw * 2 - 0.1));
-
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{true, {{0, 0}, {0, 0}, {top, bottom}, {left, right}}, ai2d_pad_mode::constant, {padding[0], padding[1], padding[2]}};
-    ai2d_resize_param_t resize_param{true, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{false, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {0.5, 0.1, 0.0, 0.1, 0.5, 0.0}};
-
-    dims_t in_shape = ai2d_in_tensor.shape();
-    dims_t out_shape = ai2d_out_tensor.shape();
-    builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
-    builder->build_schedule();
-    builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-void Utils::affine(FrameCHWSize ori_shape, std::vector<uint8_t> &ori_data, float *affine_matrix, runtime_tensor &ai2d_out_tensor)
-{
-    runtime_tensor ai2d_in_tensor;
-    // init ai2d in/out
-    dims_t in_shape{1, ori_shape.channel, ori_shape.height, ori_shape.width};
-    ai2d_in_tensor = host_runtime_tensor::create(typecode_t::dt_uint8, in_shape, hrt::pool_shared).expect("cannot create input tensor");
-
-    // ai2d input
-    auto input_buf = ai2d_in_tensor.impl()->to_host().unwrap()->buffer().as_host().unwrap().map(map_access_::map_write).unwrap().buffer();
-    memcpy(reinterpret_cast<char *>(input_buf.data()), ori_data.data(), ori_data.size());
-    hrt::sync(ai2d_in_tensor, sync_op_t::sync_write_back, true).expect("write back input failed");
-
-    // run ai2d
-    
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{false, {{0, 0}, {0, 0}, {0, 0}, {10, 0}}, ai2d_pad_mode::constant, {255, 10, 5}};
-    ai2d_resize_param_t resize_param{false, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{true, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {affine_matrix[0], affine_matrix[1], affine_matrix[2], affine_matrix[3], affine_matrix[4], affine_matrix[5]}};
-
-    dims_t out_shape = ai2d_out_tensor.shape();
-    ai2d_builder builder { in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param };
-    builder.build_schedule();
-    builder.invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
-
-// for video(只算一次即可)
-void Utils::affine(float *affine_matrix, std::unique_ptr<ai2d_builder> &builder, runtime_tensor &ai2d_in_tensor, runtime_tensor &ai2d_out_tensor)
-{
-    // run ai2d
-    ai2d_datatype_t ai2d_dtype{ai2d_format::NCHW_FMT, ai2d_format::NCHW_FMT, ai2d_in_tensor.datatype(), ai2d_out_tensor.datatype()};
-    ai2d_crop_param_t crop_param{false, 0, 0, 0, 0};
-    ai2d_shift_param_t shift_param{false, 0};
-    ai2d_pad_param_t pad_param{false, {{0, 0}, {0, 0}, {0, 0}, {10, 0}}, ai2d_pad_mode::constant, {255, 10, 5}};
-    ai2d_resize_param_t resize_param{false, ai2d_interp_method::tf_bilinear, ai2d_interp_mode::half_pixel};
-    ai2d_affine_param_t affine_param{true, ai2d_interp_method::cv2_bilinear, 0, 0, 127, 1, {affine_matrix[0], affine_matrix[1], affine_matrix[2], affine_matrix[3], affine_matrix[4], affine_matrix[5]}};
-
-    dims_t in_shape = ai2d_in_tensor.shape();
-    dims_t out_shape = ai2d_out_tensor.shape();
-    builder.reset(new ai2d_builder(in_shape, out_shape, ai2d_dtype, crop_param, shift_param, pad_param, resize_param, affine_param));
-    builder->build_schedule();
-    builder->invoke(ai2d_in_tensor,ai2d_out_tensor).expect("error occurred in ai2d running");
-}
\ No newline at end of file